@@ -136,8 +136,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -198,10 +198,10 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AlbumModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AlbumModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -267,8 +267,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -371,8 +371,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -427,6 +427,113 @@ private Q_SLOTS:
 
         QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AlbumModel::TrackNumberRole).toInt(), 5);
     }
+
+    void modifyAlbumWithMovedTracks()
+    {
+        AlbumModel albumsModel;
+
+        auto allTracks = QList<MusicAudioTrack>();
+        for (int trackIndex = 1; trackIndex <= 6; ++trackIndex) {
+            auto newTrack = mNewTracks[trackIndex - 1];
+            newTrack.setDatabaseId(trackIndex);
+            newTrack.setAlbumName(QStringLiteral("album1"));
+            newTrack.setTitle(QStringLiteral("track") + QString::number(trackIndex));
+            allTracks.push_back(newTrack);
+        }
+
+        auto oldAlbum = MusicAlbum();
+        oldAlbum.setValid(true);
+        oldAlbum.setDatabaseId(1);
+        oldAlbum.setTitle(QStringLiteral("album1"));
+        oldAlbum.setTracks(allTracks.mid(0, 5));
+
+        albumsModel.setAlbumData(oldAlbum);
+
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeInserted);
+        QSignalSpy beginRemoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeRemoved);
+        QSignalSpy beginMoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeMoved);
+        QSignalSpy dataChangedSpy(&albumsModel, &AlbumModel::dataChanged);
+
+        auto modifiedFirstTrack = allTracks[0];
+        modifiedFirstTrack.setTitle(QStringLiteral("modifiedTrack1"));
+
+        auto newAlbum = oldAlbum;
+        newAlbum.setTracks({allTracks[1], allTracks[2], allTracks[3], modifiedFirstTrack, allTracks[5]});
+
+        albumsModel.albumModified(newAlbum);
+
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(1).toInt(), 4);
+        QCOMPARE(beginMoveRowsSpy.count(), 1);
+        QCOMPARE(beginMoveRowsSpy.at(0).at(1).toInt(), 0);
+        QCOMPARE(beginMoveRowsSpy.at(0).at(4).toInt(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex(), albumsModel.index(3, 0));
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(beginInsertRowsSpy.at(0).at(1).toInt(), 4);
+
+        QCOMPARE(albumsModel.rowCount(), 5);
+        QCOMPARE(albumsModel.data(albumsModel.index(0, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track2"));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track3"));
+        QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track4"));
+        QCOMPARE(albumsModel.data(albumsModel.index(3, 0), AlbumModel::TitleRole).toString(), QStringLiteral("modifiedTrack1"));
+        QCOMPARE(albumsModel.data(albumsModel.index(4, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track6"));
+    }
+
+    void loadTracksOfAlbumWithoutTracks()
+    {
+        DatabaseInterface musicDb;
+        AlbumModel albumsModel;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        const auto fullAlbum = musicDb.albumFromTitle(QStringLiteral("album1"));
+
+        QCOMPARE(fullAlbum.isValid(), true);
+        QCOMPARE(fullAlbum.isTracksLoaded(), true);
+
+        auto lazyAlbum = MusicAlbum();
+        lazyAlbum.setValid(true);
+        lazyAlbum.setDatabaseId(fullAlbum.databaseId());
+        lazyAlbum.setTitle(fullAlbum.title());
+        lazyAlbum.setArtist(fullAlbum.artist());
+        lazyAlbum.setTracksCount(fullAlbum.tracksCount());
+        lazyAlbum.setIsTracksLoaded(false);
+        lazyAlbum.setAllArtists(fullAlbum.allArtists());
+        lazyAlbum.setAllTracksTitle(fullAlbum.allTracksTitle());
+        lazyAlbum.setHighestTrackRating(fullAlbum.highestTrackRating());
+
+        QSignalSpy fetchAlbumTracksSpy(&albumsModel, &AlbumModel::fetchAlbumTracks);
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeInserted);
+
+        albumsModel.setAlbumData(lazyAlbum);
+
+        QCOMPARE(fetchAlbumTracksSpy.count(), 1);
+        QCOMPARE(fetchAlbumTracksSpy.at(0).at(0).toULongLong(), fullAlbum.databaseId());
+        QCOMPARE(beginInsertRowsSpy.count(), 0);
+        QCOMPARE(albumsModel.rowCount(), 0);
+        QCOMPARE(albumsModel.albumData().allArtists(), fullAlbum.allArtists());
+        QCOMPARE(albumsModel.albumData().allTracksTitle(), fullAlbum.allTracksTitle());
+        QCOMPARE(albumsModel.albumData().highestTrackRating(), fullAlbum.highestTrackRating());
+
+        albumsModel.setDatabase(&musicDb);
+
+        QCOMPARE(fetchAlbumTracksSpy.count(), 2);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(albumsModel.rowCount(), fullAlbum.tracksCount());
+
+        for (int trackIndex = 0; trackIndex < fullAlbum.tracksCount(); ++trackIndex) {
+            QCOMPARE(albumsModel.data(albumsModel.index(trackIndex, 0), AlbumModel::DatabaseIdRole).toULongLong(),
+                     fullAlbum.trackIdFromIndex(trackIndex));
+        }
+
+        albumsModel.albumTracks(fullAlbum.databaseId(), fullAlbum.allTracks());
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(albumsModel.rowCount(), fullAlbum.tracksCount());
+    }
 };
 
 QTEST_MAIN(AlbumModelTests)
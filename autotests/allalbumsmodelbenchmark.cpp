@@ -0,0 +1,151 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "allalbumsmodel.h"
+#include "musicalbum.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QList>
+#include <QElapsedTimer>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class AllAlbumsModelBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static MusicAlbum generateAlbum(int albumIndex, int revision)
+    {
+        auto newAlbum = MusicAlbum();
+
+        newAlbum.setDatabaseId(albumIndex + 1);
+        newAlbum.setTitle(QStringLiteral("album") + QString::number(albumIndex));
+        newAlbum.setArtist(QStringLiteral("artist") + QString::number(albumIndex / 8));
+        newAlbum.setAlbumArtURI(QUrl::fromLocalFile(QStringLiteral("/music/album") + QString::number(albumIndex) + QStringLiteral("/cover.jpg")));
+        newAlbum.setTracksCount(revision % 20 + 1);
+        newAlbum.setValid(true);
+
+        return newAlbum;
+    }
+
+    static QList<MusicAlbum> generateAlbums(int albumsCount)
+    {
+        auto result = QList<MusicAlbum>();
+        result.reserve(albumsCount);
+
+        for (int i = 0; i < albumsCount; ++i) {
+            result.push_back(generateAlbum(i, 0));
+        }
+
+        return result;
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<MusicAlbum>("MusicAlbum");
+    }
+
+    void modifyAlbums_data()
+    {
+        QTest::addColumn<int>("batchSize");
+
+        QTest::newRow("one album per notification") << 1;
+        QTest::newRow("100 albums per notification") << 100;
+        QTest::newRow("1000 albums per notification") << 1000;
+    }
+
+    void modifyAlbums()
+    {
+        QFETCH(int, batchSize);
+
+        const auto albumsCount = 20000;
+        const auto modificationsCount = 50000;
+
+        AllAlbumsModel albumsModel;
+
+        QSignalSpy dataChangedSpy(&albumsModel, &AllAlbumsModel::dataChanged);
+
+        albumsModel.albumsAdded(generateAlbums(albumsCount));
+
+        auto allModifications = QList<QList<MusicAlbum>>();
+        for (int i = 0; i < modificationsCount; i += batchSize) {
+            auto oneBatch = QList<MusicAlbum>();
+
+            for (int j = i; j < i + batchSize && j < modificationsCount; ++j) {
+                oneBatch.push_back(generateAlbum((j * 7919) % albumsCount, j));
+            }
+
+            allModifications.push_back(oneBatch);
+        }
+
+        QElapsedTimer modifyTimer;
+        modifyTimer.start();
+
+        for (const auto &oneBatch : allModifications) {
+            albumsModel.albumsModified(oneBatch);
+        }
+
+        const auto elapsedTime = modifyTimer.elapsed();
+
+        qDebug() << "AllAlbumsModelBenchmark::modifyAlbums" << modificationsCount << "modifications of" << albumsCount << "albums in"
+                 << elapsedTime << "ms with" << batchSize << "albums per notification," << dataChangedSpy.count() << "dataChanged signals";
+
+        QCOMPARE(albumsModel.rowCount(), albumsCount);
+    }
+
+    void removeAlbums()
+    {
+        const auto albumsCount = 20000;
+
+        AllAlbumsModel albumsModel;
+
+        const auto allAlbums = generateAlbums(albumsCount);
+
+        albumsModel.albumsAdded(allAlbums);
+
+        auto removedAlbums = QList<MusicAlbum>();
+        for (int i = 0; i < albumsCount; i += 2) {
+            removedAlbums.push_back(allAlbums[i]);
+        }
+
+        QElapsedTimer removeTimer;
+        removeTimer.start();
+
+        albumsModel.albumsRemoved(removedAlbums);
+
+        const auto elapsedTime = removeTimer.elapsed();
+
+        qDebug() << "AllAlbumsModelBenchmark::removeAlbums" << removedAlbums.count() << "removals from" << albumsCount << "albums in" << elapsedTime << "ms";
+
+        QCOMPARE(albumsModel.rowCount(), albumsCount - removedAlbums.count());
+    }
+};
+
+QTEST_MAIN(AllAlbumsModelBenchmark)
+
+
+#include "allalbumsmodelbenchmark.moc"
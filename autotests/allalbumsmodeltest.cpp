@@ -136,12 +136,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -159,11 +159,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 0);
 
         auto trackId = musicDb.trackIdFromTitleAlbumArtist(QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1"));
 
@@ -171,11 +171,11 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 1);
     }
 
     void removeOneAlbum()
@@ -194,12 +194,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -217,11 +217,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 0);
 
         auto firstTrackId = musicDb.trackIdFromTitleAlbumArtist(QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1"));
         auto firstTrack = musicDb.trackFromDatabaseId(firstTrackId);
@@ -234,11 +234,11 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI(), secondTrack.resourceURI(), thirdTrack.resourceURI(), fourthTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 1);
         QCOMPARE(endRemoveRowsSpy.count(), 1);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 0);
     }
 
     void addOneTrack()
@@ -257,12 +257,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -280,11 +280,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
                 QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"), 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -294,11 +294,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 1);
     }
 
     void addOneAlbum()
@@ -317,12 +317,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -346,11 +346,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track1"),
                 QStringLiteral("artist2"), QStringLiteral("album5"), QStringLiteral("artist2"), 1, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -369,11 +369,11 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 5);
-        QCOMPARE(endInsertRowsSpy.count(), 5);
+        QCOMPARE(beginInsertRowsSpy.count(), 2);
+        QCOMPARE(endInsertRowsSpy.count(), 2);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 0);
     }
 };
 
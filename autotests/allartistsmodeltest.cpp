@@ -136,12 +136,10 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllArtistsModel artistsModel;
 
-        connect(&musicDb, &DatabaseInterface::artistAdded,
-                &artistsModel, &AllArtistsModel::artistAdded);
-        connect(&musicDb, &DatabaseInterface::artistModified,
-                &artistsModel, &AllArtistsModel::artistModified);
-        connect(&musicDb, &DatabaseInterface::artistRemoved,
-                &artistsModel, &AllArtistsModel::artistRemoved);
+        connect(&musicDb, &DatabaseInterface::artistsAdded,
+                &artistsModel, &AllArtistsModel::artistsAdded);
+        connect(&musicDb, &DatabaseInterface::artistsRemoved,
+                &artistsModel, &AllArtistsModel::artistsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -165,8 +163,8 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -177,8 +175,8 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 1);
         QCOMPARE(endRemoveRowsSpy.count(), 1);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -200,12 +198,10 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllArtistsModel artistsModel;
 
-        connect(&musicDb, &DatabaseInterface::artistAdded,
-                &artistsModel, &AllArtistsModel::artistAdded);
-        connect(&musicDb, &DatabaseInterface::artistModified,
-                &artistsModel, &AllArtistsModel::artistModified);
-        connect(&musicDb, &DatabaseInterface::artistRemoved,
-                &artistsModel, &AllArtistsModel::artistRemoved);
+        connect(&musicDb, &DatabaseInterface::artistsAdded,
+                &artistsModel, &AllArtistsModel::artistsAdded);
+        connect(&musicDb, &DatabaseInterface::artistsRemoved,
+                &artistsModel, &AllArtistsModel::artistsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -229,8 +225,8 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -248,8 +244,8 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 7);
-        QCOMPARE(endInsertRowsSpy.count(), 7);
+        QCOMPARE(beginInsertRowsSpy.count(), 2);
+        QCOMPARE(endInsertRowsSpy.count(), 2);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "databaseinterface.h"
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "trackgenerator.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QElapsedTimer>
+#include <QTemporaryFile>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class DatabaseInterfaceBenchmark: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+    }
+
+    void insertTracksList_data()
+    {
+        QTest::addColumn<int>("tracksCount");
+
+        QTest::newRow("10k tracks") << 10000;
+        QTest::newRow("100k tracks") << 100000;
+        QTest::newRow("500k tracks") << 500000;
+    }
+
+    void insertTracksList()
+    {
+        QFETCH(int, tracksCount);
+
+        const auto newTracks = generateTracks(tracksCount);
+
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("benchmarkInsertDb") + QString::number(tracksCount), databaseFile.fileName());
+
+        QElapsedTimer insertTimer;
+        insertTimer.start();
+
+        musicDb.insertTracksList(newTracks, {}, QStringLiteral("autoTest"));
+
+        const auto elapsedTime = insertTimer.elapsed();
+
+        qDebug() << "DatabaseInterfaceBenchmark::insertTracksList" << tracksCount << "tracks in" << elapsedTime << "ms"
+                 << (elapsedTime > 0 ? tracksCount * 1000 / elapsedTime : tracksCount) << "tracks per second";
+
+        QCOMPARE(musicDb.allTracks().count(), tracksCount);
+    }
+};
+
+QTEST_MAIN(DatabaseInterfaceBenchmark)
+
+
+#include "databaseinterfacebenchmark.moc"
@@ -37,6 +37,8 @@
 
 #include <QtTest>
 
+#include <algorithm>
+
 class DatabaseInterfaceTests: public QObject
 {
     Q_OBJECT
@@ -46,6 +48,18 @@ private:
     QList<MusicAudioTrack> mNewTracks;
     QHash<QString, QUrl> mNewCovers;
 
+    template <typename Entity>
+    static int entitiesCount(const QSignalSpy &batchSpy)
+    {
+        auto result = 0;
+
+        for (const auto &oneBatch : batchSpy) {
+            result += oneBatch.at(0).value<QList<Entity>>().count();
+        }
+
+        return result;
+    }
+
 private Q_SLOTS:
 
     void initTestCase()
@@ -121,6 +135,9 @@ private Q_SLOTS:
         qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<MusicArtist>("MusicArtist");
+        qRegisterMetaType<QList<MusicAlbum>>("QList<MusicAlbum>");
+        qRegisterMetaType<QList<MusicArtist>>("QList<MusicArtist>");
+        qRegisterMetaType<QHash<QUrl,QPair<qint64,QDateTime>>>("QHash<QUrl,QPair<qint64,QDateTime>>");
     }
 
     void avoidCrashInTrackIdFromTitleAlbumArtist()
@@ -156,7 +173,7 @@ private Q_SLOTS:
 
         DatabaseInterface musicDb;
 
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -165,7 +182,7 @@ private Q_SLOTS:
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -198,13 +215,13 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
             musicDb.init(QStringLiteral("testDb1"), myTempDatabase.fileName());
 
             musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -221,13 +238,13 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
             musicDb.init(QStringLiteral("testDb2"), myTempDatabase.fileName());
 
             musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -255,13 +272,13 @@ private Q_SLOTS:
                                     QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"), 6, 1, QTime::fromMSecsSinceStartOfDay(19),
                                     {QUrl::fromLocalFile(QStringLiteral("/$19"))}, {QUrl::fromLocalFile(QStringLiteral("album3"))}, 5});
 
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
             musicDb.init(QStringLiteral("testDb1"), myTempDatabase.fileName());
 
             musicDb.insertTracksList(allNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -295,7 +312,7 @@ private Q_SLOTS:
                                     QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"), 6, 1, QTime::fromMSecsSinceStartOfDay(19),
                                     {QUrl::fromLocalFile(QStringLiteral("/$19"))}, {QUrl::fromLocalFile(QStringLiteral("album3"))}, 3});
 
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
             musicDb.init(QStringLiteral("testDb2"), myTempDatabase.fileName());
 
@@ -306,7 +323,7 @@ private Q_SLOTS:
 
             musicDb.insertTracksList(allNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -334,6 +351,46 @@ private Q_SLOTS:
         }
     }
 
+    void restoreExistingDatabase()
+    {
+        QTemporaryFile myTempDatabase;
+        myTempDatabase.open();
+
+        {
+            DatabaseInterface musicDb;
+
+            musicDb.init(QStringLiteral("testDbRestoreFill"), myTempDatabase.fileName());
+
+            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+            QCOMPARE(musicDb.allAlbums().count(), 3);
+        }
+
+        {
+            DatabaseInterface musicDb;
+
+            QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+            QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+            musicDb.init(QStringLiteral("testDbRestore"), myTempDatabase.fileName());
+
+            QCOMPARE(musicDbArtistsAddedSpy.count(), 1);
+            QCOMPARE(musicDbAlbumsAddedSpy.count(), 1);
+            QCOMPARE(musicDbTracksAddedSpy.count(), 1);
+
+            const auto restoredArtists = musicDbArtistsAddedSpy.at(0).at(0).value<QList<MusicArtist>>();
+            const auto restoredAlbums = musicDbAlbumsAddedSpy.at(0).at(0).value<QList<MusicAlbum>>();
+            const auto restoredTracks = musicDbTracksAddedSpy.at(0).at(0).value<QList<qulonglong>>();
+
+            QCOMPARE(restoredArtists.count(), 6);
+            QCOMPARE(restoredAlbums.count(), 3);
+            QCOMPARE(restoredAlbums[0].title(), QStringLiteral("album1"));
+            QCOMPARE(restoredAlbums[1].title(), QStringLiteral("album2"));
+            QCOMPARE(restoredAlbums[2].title(), QStringLiteral("album3"));
+            QCOMPARE(restoredTracks.count(), 13);
+        }
+    }
 
     void simpleAccessor()
     {
@@ -350,7 +407,7 @@ private Q_SLOTS:
 
         DatabaseInterface musicDb;
 
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -365,7 +422,7 @@ private Q_SLOTS:
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
 
@@ -449,9 +506,9 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -464,12 +521,12 @@ private Q_SLOTS:
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
 
         auto allAlbums = musicDb.allAlbums();
 
@@ -629,9 +686,9 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -641,12 +698,12 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
                 QStringLiteral("artist6"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -661,12 +718,12 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest2"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 14);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 7);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 14);
 
         auto allTracks = musicDb.allTracksFromSource(QStringLiteral("autoTest"));
 
@@ -676,6 +733,68 @@ private Q_SLOTS:
         QCOMPARE(allTracks2.count(), 1);
     }
 
+    void tracksFromDatabaseIdsInBatches()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbTracksFromIdsInBatches"));
+
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        QCOMPARE(musicDbTracksAddedSpy.count(), 1);
+
+        const auto addedTracksIds = musicDbTracksAddedSpy.at(0).at(0).value<QList<qulonglong>>();
+
+        auto wantedIds = QList<qulonglong>();
+        for (auto oneTrackId : addedTracksIds) {
+            wantedIds.push_back(oneTrackId);
+
+            for (int i = 0; i < 20; ++i) {
+                wantedIds.push_back(100000 + wantedIds.size());
+            }
+        }
+
+        QVERIFY(wantedIds.size() > 200);
+
+        const auto allTracks = musicDb.tracksFromDatabaseIds(wantedIds);
+
+        QCOMPARE(allTracks.count(), addedTracksIds.count());
+
+        for (const auto &oneTrack : allTracks) {
+            QVERIFY(addedTracksIds.contains(oneTrack.databaseId()));
+            QCOMPARE(oneTrack, musicDb.trackFromDatabaseId(oneTrack.databaseId()));
+        }
+    }
+
+    void tracksKeyFromDatabaseIds()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbTracksKeyFromIds"));
+
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        QCOMPARE(musicDbTracksAddedSpy.count(), 1);
+
+        const auto addedTracksIds = musicDbTracksAddedSpy.at(0).at(0).value<QList<qulonglong>>();
+
+        const auto allTracksKey = musicDb.tracksKeyFromDatabaseIds(addedTracksIds);
+
+        QCOMPARE(allTracksKey.count(), addedTracksIds.count());
+
+        for (const auto &oneTrackKey : allTracksKey) {
+            const auto oneTrack = musicDb.trackFromDatabaseId(oneTrackKey.databaseId());
+
+            QCOMPARE(oneTrackKey.title(), oneTrack.title());
+            QCOMPARE(oneTrackKey.artist(), oneTrack.artist());
+            QCOMPARE(oneTrackKey.albumName(), oneTrack.albumName());
+        }
+    }
+
     void simpleAccessorAndVariousArtistAlbumWithFile()
     {
         QTemporaryFile myDatabaseFile;
@@ -684,21 +803,18 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 0);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+            QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
 
             musicDb.init(QStringLiteral("testDbVariousArtistAlbum1"), myDatabaseFile.fileName());
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 0);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+            QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
 
             auto newFiles = QList<QUrl>();
             const auto &constNewTracks = mNewTracks;
@@ -708,12 +824,12 @@ private Q_SLOTS:
 
             musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+            QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
 
             auto allAlbums = musicDb.allAlbums();
 
@@ -870,21 +986,33 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+            QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+            QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+            QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 0);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+            QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
 
-            musicDb.init(QStringLiteral("testDbVariousArtistAlbum2"), myDatabaseFile.fileName());
+            musicDb.init(QStringLiteral("testDbVariousArtistAlbum2"), myDatabaseFile.fileName(), 2);
+
+            auto restoredAlbums = QList<MusicAlbum>();
+            for (const auto &oneBatch : musicDbAlbumsAddedSpy) {
+                restoredAlbums += oneBatch.at(0).value<QList<MusicAlbum>>();
+            }
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+            QCOMPARE(musicDbArtistsAddedSpy.count(), 3);
+            QCOMPARE(musicDbAlbumsAddedSpy.count(), 2);
+            QCOMPARE(musicDbTracksAddedSpy.count(), 7);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+            QCOMPARE(restoredAlbums.count(), 3);
+            QCOMPARE(restoredAlbums[0].title(), QStringLiteral("album1"));
+            QCOMPARE(restoredAlbums[0].tracksCount(), 4);
+            QCOMPARE(restoredAlbums[1].title(), QStringLiteral("album2"));
+            QCOMPARE(restoredAlbums[2].title(), QStringLiteral("album3"));
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
 
             auto newFiles = QList<QUrl>();
             const auto &constNewTracks = mNewTracks;
@@ -894,12 +1022,12 @@ private Q_SLOTS:
 
             musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+            QCOMPARE(musicDbArtistsAddedSpy.count(), 3);
+            QCOMPARE(musicDbAlbumsAddedSpy.count(), 2);
+            QCOMPARE(musicDbTracksAddedSpy.count(), 7);
 
             auto allAlbums = musicDb.allAlbums();
 
@@ -1065,12 +1193,12 @@ private Q_SLOTS:
 
             musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-            musicDbTrackAddedSpy.wait(300);
+            musicDbTracksAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-            QCOMPARE(musicDbTrackAddedSpy.count(), 14);
+            QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 1);
+            QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+            QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 1);
         }
     }
 
@@ -1090,9 +1218,6 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1102,12 +1227,12 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
 
         auto allTracks = musicDb.tracksFromAuthor(QStringLiteral("artist1"));
 
@@ -1137,27 +1262,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1167,19 +1290,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto allAlbums = musicDb.allAlbums();
 
@@ -1204,15 +1326,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 1);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 1);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto allAlbumsV2 = musicDb.allAlbums();
         const auto &firstAlbum = allAlbumsV2[0];
@@ -1237,6 +1358,137 @@ private Q_SLOTS:
         QCOMPARE(removedTrackId, qulonglong(0));
     }
 
+    void publishOneChangeSetPerTransaction()
+    {
+        auto configDirectory = QDir(QStandardPaths::writableLocation(QStandardPaths::QStandardPaths::AppDataLocation));
+        auto rootDirectory = QDir::root();
+        rootDirectory.mkpath(configDirectory.path());
+        auto fileName = configDirectory.filePath(QStringLiteral("elisaMusicDatabase.sqlite"));
+        QFile dbFile(fileName);
+        auto dbExists = dbFile.exists();
+
+        if (dbExists) {
+            QCOMPARE(dbFile.remove(), true);
+        }
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        QCOMPARE(musicDbArtistsAddedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsAddedSpy.count(), 1);
+        QCOMPARE(musicDbTracksAddedSpy.count(), 1);
+        QCOMPARE(musicDbArtistsRemovedSpy.count(), 0);
+        QCOMPARE(musicDbAlbumsRemovedSpy.count(), 0);
+        QCOMPARE(musicDbTracksRemovedSpy.count(), 0);
+        QCOMPARE(musicDbAlbumsModifiedSpy.count(), 0);
+        QCOMPARE(musicDbTracksModifiedSpy.count(), 0);
+
+        QCOMPARE(musicDbArtistsAddedSpy.at(0).at(0).value<QList<MusicArtist>>().count(), 6);
+        QCOMPARE(musicDbAlbumsAddedSpy.at(0).at(0).value<QList<MusicAlbum>>().count(), 3);
+        QCOMPARE(musicDbTracksAddedSpy.at(0).at(0).value<QList<qulonglong>>().count(), 13);
+
+        auto firstTrackId = musicDb.trackIdFromTitleAlbumArtist(QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1"));
+        auto firstTrack = musicDb.trackFromDatabaseId(firstTrackId);
+        auto secondTrackId = musicDb.trackIdFromTitleAlbumArtist(QStringLiteral("track2"), QStringLiteral("album1"), QStringLiteral("artist2"));
+        auto secondTrack = musicDb.trackFromDatabaseId(secondTrackId);
+
+        musicDb.removeTracksList({firstTrack.resourceURI(), secondTrack.resourceURI()});
+
+        QCOMPARE(musicDbTracksRemovedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsModifiedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsRemovedSpy.count(), 0);
+
+        const auto removedTracks = musicDbTracksRemovedSpy.at(0).at(0).value<QList<MusicAudioTrack>>();
+        QCOMPARE(removedTracks.count(), 2);
+        QCOMPARE(removedTracks[0].databaseId(), firstTrackId);
+        QCOMPARE(removedTracks[0].title(), QStringLiteral("track1"));
+        QCOMPARE(removedTracks[1].databaseId(), secondTrackId);
+        QCOMPARE(removedTracks[1].title(), QStringLiteral("track2"));
+
+        const auto modifiedAlbums = musicDbAlbumsModifiedSpy.at(0).at(0).value<QList<MusicAlbum>>();
+        QCOMPARE(modifiedAlbums.count(), 1);
+        QCOMPARE(modifiedAlbums[0].title(), QStringLiteral("album1"));
+        QCOMPARE(modifiedAlbums[0].tracksCount(), 2);
+    }
+
+    void addSameAlbumTitleForTwoAlbumArtists()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbSameAlbumTitle"));
+
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+
+        auto newTracks = QList<MusicAudioTrack>{
+            {true, QStringLiteral("$1"), QStringLiteral("0"), QStringLiteral("track1"),
+                QStringLiteral("artist1"), QStringLiteral("Greatest Hits"), QStringLiteral("artist1"), 1, 1, QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/$1"))},
+        {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1},
+            {true, QStringLiteral("$2"), QStringLiteral("0"), QStringLiteral("track1"),
+                QStringLiteral("artist2"), QStringLiteral("Greatest Hits"), QStringLiteral("artist2"), 1, 1, QTime::fromMSecsSinceStartOfDay(2), {QUrl::fromLocalFile(QStringLiteral("/$2"))},
+        {QUrl::fromLocalFile(QStringLiteral("file://image$2"))}, 2},
+            {true, QStringLiteral("$3"), QStringLiteral("0"), QStringLiteral("track2"),
+                QStringLiteral("artist1"), QStringLiteral("Greatest Hits"), QStringLiteral("artist1"), 2, 1, QTime::fromMSecsSinceStartOfDay(3), {QUrl::fromLocalFile(QStringLiteral("/$3"))},
+        {QUrl::fromLocalFile(QStringLiteral("file://image$3"))}, 3},
+        };
+
+        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        QCOMPARE(musicDbAlbumsAddedSpy.count(), 1);
+
+        auto newAlbums = musicDbAlbumsAddedSpy.at(0).at(0).value<QList<MusicAlbum>>();
+        QCOMPARE(newAlbums.count(), 2);
+
+        std::sort(newAlbums.begin(), newAlbums.end(), [](const MusicAlbum &first, const MusicAlbum &second) {return first.artist() < second.artist();});
+
+        QCOMPARE(newAlbums[0].title(), QStringLiteral("Greatest Hits"));
+        QCOMPARE(newAlbums[0].artist(), QStringLiteral("artist1"));
+        QCOMPARE(newAlbums[0].tracksCount(), 2);
+        QCOMPARE(newAlbums[1].title(), QStringLiteral("Greatest Hits"));
+        QCOMPARE(newAlbums[1].artist(), QStringLiteral("artist2"));
+        QCOMPARE(newAlbums[1].tracksCount(), 1);
+        QVERIFY(newAlbums[0].databaseId() != newAlbums[1].databaseId());
+    }
+
+    void restoredTracksKeepFileModifiedTime()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbRestoredFileModifiedTime"));
+
+        QSignalSpy musicDbRestoredTracksSpy(&musicDb, &DatabaseInterface::restoredTracks);
+
+        auto newTrack = MusicAudioTrack{true, QStringLiteral("$1"), QStringLiteral("0"), QStringLiteral("track1"),
+                QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("artist1"), 1, 1, QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/$1"))},
+        {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1};
+        const auto fileModifiedTime = QDateTime::fromMSecsSinceEpoch(Q_INT64_C(1508155200123));
+        newTrack.setFileSize(1234);
+        newTrack.setFileModifiedTime(fileModifiedTime);
+
+        musicDb.insertTracksList({newTrack}, mNewCovers, QStringLiteral("autoTest"));
+
+        musicDb.askRestoredTracks(QStringLiteral("autoTest"));
+
+        QCOMPARE(musicDbRestoredTracksSpy.count(), 1);
+
+        const auto restoredFiles = musicDbRestoredTracksSpy.at(0).at(1).value<QHash<QUrl, QPair<qint64, QDateTime>>>();
+
+        QCOMPARE(restoredFiles.count(), 1);
+        QCOMPARE(restoredFiles[newTrack.resourceURI()].first, qint64(1234));
+        QCOMPARE(restoredFiles[newTrack.resourceURI()].second.toMSecsSinceEpoch(), fileModifiedTime.toMSecsSinceEpoch());
+    }
+
     void removeOneAlbum()
     {
         auto configDirectory = QDir(QStandardPaths::writableLocation(QStandardPaths::QStandardPaths::AppDataLocation));
@@ -1254,27 +1506,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1284,19 +1534,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto allAlbums = musicDb.allAlbums();
 
@@ -1326,15 +1575,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 4);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 1);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 4);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 2);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 1);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 4);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto removedAlbum = musicDb.albumFromTitle(QStringLiteral("album1"));
 
@@ -1358,27 +1606,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1388,19 +1634,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto allAlbums = musicDb.allAlbums();
 
@@ -1424,15 +1669,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 5);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 1);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 1);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 1);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
     }
     void addOneTrack()
     {
@@ -1451,27 +1695,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1481,19 +1723,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
                 QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"), 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -1503,19 +1744,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 14);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 1);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
     }
 
 
@@ -1536,27 +1776,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1566,19 +1804,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto modifiedTrack = MusicAudioTrack{true, QStringLiteral("$3"), QStringLiteral("0"), QStringLiteral("track3"),
                 QStringLiteral("artist3"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 5, 3,
@@ -1588,15 +1825,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 1);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 1);
 
         auto trackId = musicDb.trackIdFromTitleAlbumArtist(QStringLiteral("track3"), QStringLiteral("album1"), QStringLiteral("artist3"));
         QCOMPARE(trackId != 0, true);
@@ -1623,27 +1859,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1653,19 +1887,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track1"),
                 QStringLiteral("artist2"), QStringLiteral("album5"), QStringLiteral("artist2"), 1, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -1679,19 +1912,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 4);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 4);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 14);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
     }
 
     void addOneArtist()
@@ -1711,27 +1943,25 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
-        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
-        QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
-        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTracksAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTracksModifiedSpy(&musicDb, &DatabaseInterface::tracksModified);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 0);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newFiles = QList<QUrl>();
         const auto &constNewTracks = mNewTracks;
@@ -1741,19 +1971,18 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 6);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 13);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 0);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
                 QStringLiteral("artist6"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -1768,19 +1997,224 @@ private Q_SLOTS:
 
         musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
 
-        musicDbTrackAddedSpy.wait(300);
+        musicDbTracksAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 7);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
-        QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
-        QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
-        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsAddedSpy), 7);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsAddedSpy), 3);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksAddedSpy), 14);
+        QCOMPARE(entitiesCount<MusicArtist>(musicDbArtistsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAudioTrack>(musicDbTracksRemovedSpy), 0);
+        QCOMPARE(entitiesCount<MusicAlbum>(musicDbAlbumsModifiedSpy), 1);
+        QCOMPARE(entitiesCount<qulonglong>(musicDbTracksModifiedSpy), 0);
+    }
+
+    void searchLibraryByPrefix()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbSearchLibrary"));
+
+        QSignalSpy musicDbSearchResultSpy(&musicDb, &DatabaseInterface::librarySearchResult);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        const auto secondAlbum = musicDb.albumFromTitle(QStringLiteral("album2"));
+
+        QVERIFY(secondAlbum.isValid());
+
+        musicDb.searchLibrary(QStringLiteral("albu"));
+
+        QCOMPARE(musicDbSearchResultSpy.count(), 1);
+        QCOMPARE(musicDbSearchResultSpy.at(0).at(0).toString(), QStringLiteral("albu"));
+        QCOMPARE(musicDbSearchResultSpy.at(0).at(1).value<QList<qulonglong>>().count(), 3);
+
+        musicDb.searchLibrary(QStringLiteral("ALBUM2"));
+
+        QCOMPARE(musicDbSearchResultSpy.count(), 2);
+        QCOMPARE(musicDbSearchResultSpy.at(1).at(1).value<QList<qulonglong>>(), QList<qulonglong>{secondAlbum.databaseId()});
+        QCOMPARE(musicDbSearchResultSpy.at(1).at(2).value<QList<qulonglong>>().count(), secondAlbum.tracksCount());
+
+        musicDb.searchLibrary(QStringLiteral("  "));
+
+        QCOMPARE(musicDbSearchResultSpy.count(), 3);
+        QCOMPARE(musicDbSearchResultSpy.at(2).at(1).value<QList<qulonglong>>().count(), 0);
+    }
+
+    void searchLibraryWithoutDatabase()
+    {
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbSearchResultSpy(&musicDb, &DatabaseInterface::librarySearchResult);
+        QSignalSpy musicDbAlbumsWindowSpy(&musicDb, &DatabaseInterface::albumsWindow);
+
+        musicDb.searchLibrary(QStringLiteral("album"));
+
+        QCOMPARE(musicDbSearchResultSpy.count(), 1);
+        QCOMPARE(musicDbSearchResultSpy.at(0).at(0).toString(), QStringLiteral("album"));
+        QCOMPARE(musicDbSearchResultSpy.at(0).at(1).value<QList<qulonglong>>().count(), 0);
+        QCOMPARE(musicDbSearchResultSpy.at(0).at(2).value<QList<qulonglong>>().count(), 0);
+
+        musicDb.fetchAlbumsWindow(QStringLiteral("album"), 0, 0, 10);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(2).toInt(), 0);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(4).value<QList<MusicAlbum>>().count(), 0);
+    }
+
+    void fetchAlbumsAndArtistsWindows()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbFetchWindows"));
+
+        QSignalSpy musicDbAlbumsWindowSpy(&musicDb, &DatabaseInterface::albumsWindow);
+        QSignalSpy musicDbArtistsWindowSpy(&musicDb, &DatabaseInterface::artistsWindow);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        const auto allAlbums = musicDb.allAlbums();
+        const auto allArtists = musicDb.allArtists();
+
+        musicDb.fetchAlbumsWindow({}, 0, 1, 2);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(2).toInt(), allAlbums.count());
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(3).toInt(), 1);
+
+        const auto albumsWindow = musicDbAlbumsWindowSpy.at(0).at(4).value<QList<MusicAlbum>>();
+
+        QCOMPARE(albumsWindow.count(), 2);
+        QCOMPARE(albumsWindow.at(0).title(), QStringLiteral("album2"));
+        QCOMPARE(albumsWindow.at(0).isTracksLoaded(), false);
+        QCOMPARE(albumsWindow.at(0).tracksCount(), musicDb.albumFromTitle(QStringLiteral("album2")).tracksCount());
+
+        musicDb.fetchArtistsWindow(0, allArtists.count() + 10);
+
+        QCOMPARE(musicDbArtistsWindowSpy.count(), 1);
+        QCOMPARE(musicDbArtistsWindowSpy.at(0).at(0).toInt(), allArtists.count());
+        QCOMPARE(musicDbArtistsWindowSpy.at(0).at(2).value<QList<MusicArtist>>().count(), allArtists.count());
+    }
+
+    void fetchMatchingAlbumsWindows()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbFetchMatchingWindows"));
+
+        QSignalSpy musicDbAlbumsWindowSpy(&musicDb, &DatabaseInterface::albumsWindow);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        const auto secondAlbum = musicDb.albumFromTitle(QStringLiteral("album2"));
+
+        QVERIFY(secondAlbum.isValid());
+
+        musicDb.fetchAlbumsWindow(QStringLiteral("ALBUM2"), 0, 0, 10);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(0).toString(), QStringLiteral("ALBUM2"));
+        QCOMPARE(musicDbAlbumsWindowSpy.at(0).at(2).toInt(), 1);
+
+        const auto matchingAlbums = musicDbAlbumsWindowSpy.at(0).at(4).value<QList<MusicAlbum>>();
+
+        QCOMPARE(matchingAlbums.count(), 1);
+        QCOMPARE(matchingAlbums.at(0).databaseId(), secondAlbum.databaseId());
+
+        musicDb.fetchAlbumsWindow({}, 0, 0, 10);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 2);
+
+        const auto allAlbums = musicDbAlbumsWindowSpy.at(1).at(4).value<QList<MusicAlbum>>();
+        const auto highlyRatedCount = std::count_if(allAlbums.begin(), allAlbums.end(),
+                                                    [](const MusicAlbum &oneAlbum) {return oneAlbum.highestTrackRating() >= 5;});
+
+        QVERIFY(highlyRatedCount > 0);
+        QVERIFY(highlyRatedCount < allAlbums.count());
+
+        musicDb.fetchAlbumsWindow(QStringLiteral("albu"), 5, 0, 10);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 3);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(2).at(1).toInt(), 5);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(2).at(2).toInt(), int(highlyRatedCount));
+        QCOMPARE(musicDbAlbumsWindowSpy.at(2).at(4).value<QList<MusicAlbum>>().count(), int(highlyRatedCount));
+
+        musicDb.fetchAlbumsWindow(QStringLiteral("nothingMatchesThis"), 0, 0, 10);
+
+        QCOMPARE(musicDbAlbumsWindowSpy.count(), 4);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(3).at(2).toInt(), 0);
+        QCOMPARE(musicDbAlbumsWindowSpy.at(3).at(4).value<QList<MusicAlbum>>().count(), 0);
+    }
+
+    void fetchArtistAlbums()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbFetchArtistAlbums"));
+
+        QSignalSpy musicDbArtistAlbumsSpy(&musicDb, &DatabaseInterface::artistAlbums);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+        const auto allArtists = musicDb.allArtists();
+        const auto secondArtist = std::find_if(allArtists.begin(), allArtists.end(),
+                                               [](const MusicArtist &oneArtist) {return oneArtist.name() == QStringLiteral("artist2");});
+
+        QVERIFY(secondArtist != allArtists.end());
+
+        musicDb.fetchArtistAlbums(secondArtist->databaseId());
+
+        QCOMPARE(musicDbArtistAlbumsSpy.count(), 1);
+        QCOMPARE(musicDbArtistAlbumsSpy.at(0).at(0).toULongLong(), secondArtist->databaseId());
+
+        const auto artistAlbums = musicDbArtistAlbumsSpy.at(0).at(1).value<QList<MusicAlbum>>();
+
+        auto artistAlbumsTitles = QStringList();
+        for (const auto &oneAlbum : artistAlbums) {
+            QCOMPARE(oneAlbum.isTracksLoaded(), false);
+            artistAlbumsTitles.push_back(oneAlbum.title());
+        }
+
+        QVERIFY(artistAlbumsTitles.contains(QStringLiteral("album1")));
+        QVERIFY(!artistAlbumsTitles.contains(QStringLiteral("album2")));
+        QVERIFY(artistAlbumsTitles.contains(QStringLiteral("album3")));
+
+        musicDb.fetchArtistAlbums(0);
+
+        QCOMPARE(musicDbArtistAlbumsSpy.count(), 2);
+        QCOMPARE(musicDbArtistAlbumsSpy.at(1).at(1).value<QList<MusicAlbum>>().count(), 0);
+    }
+
+    void albumsSortedBySortKey()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbAlbumsSortKey"));
+
+        const auto albumTitles = QStringList{QStringLiteral("Zebra"), QStringLiteral("album 10"), QStringLiteral("\u00c9t\u00e9"),
+                                             QStringLiteral("The Beatles"), QStringLiteral("album 9"), QStringLiteral("Apple")};
+
+        auto newTracks = QList<MusicAudioTrack>();
+        for (int i = 0; i < albumTitles.size(); ++i) {
+            newTracks.push_back({true, QStringLiteral("$") + QString::number(i), QStringLiteral("0"), QStringLiteral("track1"),
+                                 QStringLiteral("artist1"), albumTitles[i], QStringLiteral("artist1"), 1, 1,
+                                 QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/sortKey") + QString::number(i))},
+                                 {QUrl::fromLocalFile(albumTitles[i])}, 1});
+        }
+
+        musicDb.insertTracksList(newTracks, {}, QStringLiteral("autoTest"));
+
+        const auto allAlbums = musicDb.allAlbums();
+
+        QCOMPARE(allAlbums.count(), 6);
+        QCOMPARE(allAlbums[0].title(), QStringLiteral("album 9"));
+        QCOMPARE(allAlbums[1].title(), QStringLiteral("album 10"));
+        QCOMPARE(allAlbums[2].title(), QStringLiteral("Apple"));
+        QCOMPARE(allAlbums[3].title(), QStringLiteral("The Beatles"));
+        QCOMPARE(allAlbums[4].title(), QStringLiteral("\u00c9t\u00e9"));
+        QCOMPARE(allAlbums[5].title(), QStringLiteral("Zebra"));
     }
 };
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "databaseinterface.h"
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "trackgenerator.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QElapsedTimer>
+#include <QTemporaryFile>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class DatabaseSearchBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    QTemporaryFile mDatabaseFile;
+
+    DatabaseInterface mMusicDb;
+
+    const int mTracksCount = 200000;
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+        qRegisterMetaType<QList<qulonglong>>("QList<qulonglong>");
+
+        mDatabaseFile.open();
+
+        mMusicDb.init(QStringLiteral("benchmarkSearchDb"), mDatabaseFile.fileName());
+
+        mMusicDb.insertTracksList(generateTracks(mTracksCount), {}, QStringLiteral("autoTest"));
+    }
+
+    void searchLibrary_data()
+    {
+        QTest::addColumn<QString>("searchText");
+
+        QTest::newRow("one character") << QStringLiteral("a");
+        QTest::newRow("two characters") << QStringLiteral("tr");
+        QTest::newRow("five characters") << QStringLiteral("album");
+        QTest::newRow("five characters, no match") << QStringLiteral("zzzzz");
+    }
+
+    void searchLibrary()
+    {
+        QFETCH(QString, searchText);
+
+        QSignalSpy searchResultSpy(&mMusicDb, &DatabaseInterface::librarySearchResult);
+
+        QElapsedTimer searchTimer;
+        searchTimer.start();
+
+        mMusicDb.searchLibrary(searchText);
+
+        const auto elapsedTime = searchTimer.nsecsElapsed() / 1000;
+
+        QCOMPARE(searchResultSpy.count(), 1);
+
+        const auto albumIds = searchResultSpy.at(0).at(1).value<QList<qulonglong>>();
+        const auto trackIds = searchResultSpy.at(0).at(2).value<QList<qulonglong>>();
+
+        qDebug() << "DatabaseSearchBenchmark::searchLibrary" << searchText << "on" << mTracksCount << "tracks in" << elapsedTime << "us,"
+                 << albumIds.count() << "albums" << trackIds.count() << "tracks";
+    }
+};
+
+QTEST_MAIN(DatabaseSearchBenchmark)
+
+
+#include "databasesearchbenchmark.moc"
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "databaseinterface.h"
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "trackgenerator.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QTemporaryFile>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class DatabaseStartupBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    void measureStartup(const QString &databaseFileName, const QString &connectionName)
+    {
+        QElapsedTimer startupTimer;
+        startupTimer.start();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(connectionName, databaseFileName);
+
+        const auto initTime = startupTimer.elapsed();
+
+        startupTimer.restart();
+
+        const auto allAlbums = musicDb.allAlbums();
+
+        const auto allAlbumsTime = startupTimer.elapsed();
+
+        qDebug() << "DatabaseStartupBenchmark" << connectionName << "init and restore in" << initTime << "ms,"
+                 << allAlbums.count() << "albums loaded in" << allAlbumsTime << "ms";
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+    }
+
+    void startupWithExistingDatabase()
+    {
+        const auto existingDatabase = qgetenv("ELISA_BENCHMARK_DATABASE");
+
+        if (existingDatabase.isEmpty()) {
+            QSKIP("set ELISA_BENCHMARK_DATABASE to the path of an existing elisaDatabase.db");
+        }
+
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+        databaseFile.close();
+
+        QFile::remove(databaseFile.fileName());
+        QVERIFY(QFile::copy(QString::fromLocal8Bit(existingDatabase), databaseFile.fileName()));
+
+        measureStartup(databaseFile.fileName(), QStringLiteral("benchmarkExistingDb"));
+    }
+
+    void startupWithGeneratedDatabase_data()
+    {
+        QTest::addColumn<int>("tracksCount");
+
+        QTest::newRow("10k tracks") << 10000;
+        QTest::newRow("100k tracks") << 100000;
+        QTest::newRow("180k tracks") << 180000;
+    }
+
+    void startupWithGeneratedDatabase()
+    {
+        QFETCH(int, tracksCount);
+
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        {
+            DatabaseInterface musicDb;
+
+            musicDb.init(QStringLiteral("benchmarkFillDb") + QString::number(tracksCount), databaseFile.fileName());
+
+            musicDb.insertTracksList(generateTracks(tracksCount), {}, QStringLiteral("autoTest"));
+        }
+
+        measureStartup(databaseFile.fileName(), QStringLiteral("benchmarkStartupDb") + QString::number(tracksCount));
+    }
+};
+
+QTEST_MAIN(DatabaseStartupBenchmark)
+
+
+#include "databasestartupbenchmark.moc"
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "abstractfile/directorymonitor.h"
+
+#include "config-upnp-qt.h"
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class DirectoryMonitorOwner: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    DirectoryMonitorOwner() : mMonitor(new DirectoryMonitor(this))
+    {
+    }
+
+    DirectoryMonitor* monitor() const
+    {
+        return mMonitor;
+    }
+
+public Q_SLOTS:
+
+    bool addDirectory(const QString &path)
+    {
+        return mMonitor->addDirectory(path);
+    }
+
+private:
+
+    DirectoryMonitor *mMonitor = nullptr;
+
+};
+
+class DirectoryMonitorTests: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QStringList>("QStringList");
+    }
+
+    void coalesceCreatedFiles()
+    {
+        QTemporaryDir rootDirectory;
+        QVERIFY(rootDirectory.isValid());
+
+        DirectoryMonitor myMonitor;
+
+        QSignalSpy directoriesChangedSpy(&myMonitor, &DirectoryMonitor::directoriesChanged);
+        QSignalSpy filesModifiedSpy(&myMonitor, &DirectoryMonitor::filesModified);
+
+        QCOMPARE(myMonitor.addDirectory(rootDirectory.path()), true);
+        QCOMPARE(myMonitor.directoriesCount(), 1);
+
+        for (int i = 0; i < 50; ++i) {
+            QFile newFile(rootDirectory.path() + QStringLiteral("/track") + QString::number(i) + QStringLiteral(".ogg"));
+            QCOMPARE(newFile.open(QIODevice::WriteOnly), true);
+            newFile.write("data");
+            newFile.close();
+        }
+
+        QCOMPARE(directoriesChangedSpy.wait(), true);
+
+        QCOMPARE(directoriesChangedSpy.count(), 1);
+        QCOMPARE(directoriesChangedSpy.at(0).at(0).toStringList(), QStringList{rootDirectory.path()});
+        QCOMPARE(filesModifiedSpy.count(), 0);
+    }
+
+    void reportModifiedFiles()
+    {
+        QTemporaryDir rootDirectory;
+        QVERIFY(rootDirectory.isValid());
+
+        const auto fileName = rootDirectory.path() + QStringLiteral("/track.ogg");
+
+        QFile existingFile(fileName);
+        QCOMPARE(existingFile.open(QIODevice::WriteOnly), true);
+        existingFile.write("data");
+        existingFile.close();
+
+        DirectoryMonitor myMonitor;
+
+        QSignalSpy directoriesChangedSpy(&myMonitor, &DirectoryMonitor::directoriesChanged);
+        QSignalSpy filesModifiedSpy(&myMonitor, &DirectoryMonitor::filesModified);
+
+        QCOMPARE(myMonitor.addDirectory(rootDirectory.path()), true);
+
+        if (!HAVE_INOTIFY) {
+            QSKIP("in place modifications are only reported with inotify");
+        }
+
+        for (int i = 0; i < 10; ++i) {
+            QCOMPARE(existingFile.open(QIODevice::Append), true);
+            existingFile.write("more data");
+            existingFile.close();
+        }
+
+        QCOMPARE(filesModifiedSpy.wait(), true);
+
+        QCOMPARE(filesModifiedSpy.count(), 1);
+        QCOMPARE(filesModifiedSpy.at(0).at(0).toStringList(), QStringList{fileName});
+        QCOMPARE(directoriesChangedSpy.count(), 0);
+    }
+
+    void forgetRemovedDirectories()
+    {
+        QTemporaryDir rootDirectory;
+        QVERIFY(rootDirectory.isValid());
+
+        QDir(rootDirectory.path()).mkpath(QStringLiteral("album"));
+
+        const auto albumPath = rootDirectory.path() + QStringLiteral("/album");
+
+        DirectoryMonitor myMonitor;
+
+        QSignalSpy directoriesChangedSpy(&myMonitor, &DirectoryMonitor::directoriesChanged);
+
+        QCOMPARE(myMonitor.addDirectory(rootDirectory.path()), true);
+        QCOMPARE(myMonitor.addDirectory(albumPath), true);
+        QCOMPARE(myMonitor.directoriesCount(), 2);
+
+        myMonitor.removeDirectory(albumPath);
+
+        QCOMPARE(myMonitor.directoriesCount(), 1);
+
+        QCOMPARE(QDir(albumPath).removeRecursively(), true);
+
+        QCOMPARE(directoriesChangedSpy.wait(), true);
+        QCOMPARE(directoriesChangedSpy.at(0).at(0).toStringList(), QStringList{rootDirectory.path()});
+    }
+
+    void watchFromWorkerThread()
+    {
+        QTemporaryDir rootDirectory;
+        QVERIFY(rootDirectory.isValid());
+
+        QThread workerThread;
+        workerThread.start();
+
+        auto myOwner = new DirectoryMonitorOwner;
+        myOwner->moveToThread(&workerThread);
+
+        QCOMPARE(myOwner->monitor()->thread(), &workerThread);
+
+        QSignalSpy directoriesChangedSpy(myOwner->monitor(), &DirectoryMonitor::directoriesChanged);
+
+        auto isWatched = false;
+        QMetaObject::invokeMethod(myOwner, "addDirectory", Qt::BlockingQueuedConnection,
+                                  Q_RETURN_ARG(bool, isWatched), Q_ARG(QString, rootDirectory.path()));
+        QCOMPARE(isWatched, true);
+
+        QFile newFile(rootDirectory.path() + QStringLiteral("/track.ogg"));
+        QCOMPARE(newFile.open(QIODevice::WriteOnly), true);
+        newFile.write("data");
+        newFile.close();
+
+        QCOMPARE(directoriesChangedSpy.wait(), true);
+        QCOMPARE(directoriesChangedSpy.count(), 1);
+        QCOMPARE(directoriesChangedSpy.at(0).at(0).toStringList(), QStringList{rootDirectory.path()});
+
+        myOwner->deleteLater();
+        workerThread.quit();
+        QCOMPARE(workerThread.wait(), true);
+    }
+};
+
+QTEST_MAIN(DirectoryMonitorTests)
+
+
+#include "directorymonitortest.moc"
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "file/localfilelisting.h"
+#include "musicaudiotrack.h"
+
+#include "config-upnp-qt.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+#include <QDir>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class LocalFileListingBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    QTemporaryDir mMusicTree;
+
+    int mFilesCount = 0;
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+        qRegisterMetaType<QList<QUrl>>("QList<QUrl>");
+
+        QVERIFY(mMusicTree.isValid());
+
+        const auto sampleFilesPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/");
+        const auto sampleFiles = QStringList{QStringLiteral("test.ogg"), QStringLiteral("test.mp3"), QStringLiteral("test.m4a")};
+
+        QDir rootDirectory(mMusicTree.path());
+
+        for (int albumIndex = 0; albumIndex < 400; ++albumIndex) {
+            const auto albumPath = QStringLiteral("artist") + QString::number(albumIndex / 10) + QStringLiteral("/album") + QString::number(albumIndex);
+
+            QVERIFY(rootDirectory.mkpath(albumPath));
+
+            for (int trackIndex = 0; trackIndex < 12; ++trackIndex) {
+                const auto &sampleFile = sampleFiles[trackIndex % sampleFiles.size()];
+                const auto newFileName = rootDirectory.filePath(albumPath + QStringLiteral("/") + QString::number(trackIndex) + QStringLiteral("-") + sampleFile);
+
+                QVERIFY(QFile::copy(sampleFilesPath + sampleFile, newFileName));
+                ++mFilesCount;
+            }
+        }
+    }
+
+    void scanGeneratedTree_data()
+    {
+        QTest::addColumn<int>("threadCount");
+
+        QTest::newRow("1 thread") << 1;
+        QTest::newRow("2 threads") << 2;
+        QTest::newRow("4 threads") << 4;
+        QTest::newRow("8 threads") << 8;
+        QTest::newRow("16 threads") << 16;
+    }
+
+    void scanGeneratedTree()
+    {
+        QFETCH(int, threadCount);
+
+        LocalFileListing myListing;
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+
+        myListing.init();
+        myListing.setRootPath(mMusicTree.path());
+        myListing.setExtractionThreadCount(threadCount);
+
+        QElapsedTimer scanTimer;
+        scanTimer.start();
+
+        myListing.refreshContent();
+
+        const auto elapsedTime = scanTimer.elapsed();
+
+        auto scannedTracksCount = 0;
+        for (const auto &oneBatch : tracksListSpy) {
+            scannedTracksCount += oneBatch.at(0).value<QList<MusicAudioTrack>>().count();
+        }
+
+        qDebug() << "LocalFileListingBenchmark::scanGeneratedTree" << threadCount << "threads" << mFilesCount << "files in" << elapsedTime << "ms"
+                 << (elapsedTime > 0 ? mFilesCount * 1000 / elapsedTime : mFilesCount) << "files per second";
+
+        QCOMPARE(scannedTracksCount, mFilesCount);
+    }
+};
+
+QTEST_MAIN(LocalFileListingBenchmark)
+
+
+#include "localfilelistingbenchmark.moc"
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "file/localfilelisting.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QDateTime>
+#include <QStringList>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class LocalFileListingDiffBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    QTemporaryDir mMusicDirectory;
+
+    int mFilesCount = 20000;
+
+    QString fileName(int index) const
+    {
+        return mMusicDirectory.path() + QStringLiteral("/track") + QString::number(index) + QStringLiteral(".ogg");
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+        qRegisterMetaType<QList<QUrl>>("QList<QUrl>");
+
+        QVERIFY(mMusicDirectory.isValid());
+
+        for (int i = 0; i < mFilesCount; ++i) {
+            QFile newFile(fileName(i));
+            QVERIFY(newFile.open(QIODevice::WriteOnly));
+        }
+    }
+
+    void repeatedChangeNotifications_data()
+    {
+        QTest::addColumn<int>("notificationsCount");
+
+        QTest::newRow("10 notifications") << 10;
+        QTest::newRow("100 notifications") << 100;
+    }
+
+    void repeatedChangeNotifications()
+    {
+        QFETCH(int, notificationsCount);
+
+        LocalFileListing myListing;
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+
+        myListing.init();
+        myListing.setRootPath(mMusicDirectory.path());
+
+        auto restoredFiles = QHash<QUrl, QPair<qint64, QDateTime>>();
+        const auto allEntries = QDir(mMusicDirectory.path()).entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+        for (const auto &oneEntry : allEntries) {
+            restoredFiles[QUrl::fromLocalFile(oneEntry.canonicalFilePath())] = {oneEntry.size(), oneEntry.lastModified()};
+        }
+
+        QElapsedTimer diffTimer;
+        diffTimer.start();
+
+        myListing.restoredTracks(QStringLiteral("local"), restoredFiles);
+
+        const auto initialScanTime = diffTimer.elapsed();
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        const auto changedDirectories = QStringList{QDir(mMusicDirectory.path()).canonicalPath()};
+
+        diffTimer.restart();
+
+        for (int i = 0; i < notificationsCount; ++i) {
+            QVERIFY(QFile::remove(fileName(i)));
+
+            QFile newFile(fileName(mFilesCount + i));
+            QVERIFY(newFile.open(QIODevice::WriteOnly));
+            newFile.close();
+
+            myListing.directoriesChanged(changedDirectories);
+        }
+
+        const auto elapsedTime = diffTimer.elapsed();
+
+        qDebug() << "LocalFileListingDiffBenchmark::repeatedChangeNotifications" << mFilesCount << "entries, initial scan in" << initialScanTime << "ms,"
+                 << notificationsCount << "notifications in" << elapsedTime << "ms";
+
+        QCOMPARE(removedTracksListSpy.count(), notificationsCount);
+
+        for (int i = 0; i < notificationsCount; ++i) {
+            QFile::remove(fileName(mFilesCount + i));
+
+            QFile restoredFile(fileName(i));
+            QVERIFY(restoredFile.open(QIODevice::WriteOnly));
+        }
+    }
+};
+
+QTEST_MAIN(LocalFileListingDiffBenchmark)
+
+
+#include "localfilelistingdiffbenchmark.moc"
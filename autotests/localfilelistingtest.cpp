@@ -32,6 +32,9 @@
 #include <QStandardPaths>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QPair>
 
 #include <QDebug>
 
@@ -437,6 +440,53 @@ private Q_SLOTS:
         QCOMPARE(newTracksLast.count(), 1);
         QCOMPARE(newCoversLast.count(), 1);
     }
+
+    void skipUnchangedRestoredTracks()
+    {
+        LocalFileListing myListing;
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+
+        myListing.init();
+        myListing.setRootPath(musicPath);
+
+        QFileInfo unchangedFile(musicPath + QStringLiteral("/test.ogg"));
+        QFileInfo modifiedFile(musicPath + QStringLiteral("/test.mp3"));
+        const auto vanishedFile = QUrl::fromLocalFile(musicPath + QStringLiteral("/vanished.ogg"));
+
+        auto restoredFiles = QHash<QUrl, QPair<qint64, QDateTime>>();
+        restoredFiles[QUrl::fromLocalFile(unchangedFile.canonicalFilePath())] = {unchangedFile.size(), unchangedFile.lastModified()};
+        restoredFiles[QUrl::fromLocalFile(modifiedFile.canonicalFilePath())] = {modifiedFile.size() + 1, modifiedFile.lastModified()};
+        restoredFiles[vanishedFile] = {1, QDateTime::currentDateTime()};
+
+        myListing.restoredTracks(QStringLiteral("otherSource"), restoredFiles);
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        myListing.restoredTracks(QStringLiteral("local"), restoredFiles);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 1);
+
+        auto newTracks = tracksListSpy.at(0).at(0).value<QList<MusicAudioTrack>>();
+        auto removedTracks = removedTracksListSpy.at(0).at(0).value<QList<QUrl>>();
+
+        QCOMPARE(newTracks.count(), 2);
+
+        for (const auto &oneTrack : newTracks) {
+            QVERIFY(oneTrack.resourceURI() != QUrl::fromLocalFile(unchangedFile.canonicalFilePath()));
+
+            QFileInfo trackFile(oneTrack.resourceURI().toLocalFile());
+            QCOMPARE(oneTrack.fileSize(), trackFile.size());
+            QCOMPARE(oneTrack.fileModifiedTime(), trackFile.lastModified());
+        }
+
+        QCOMPARE(removedTracks, QList<QUrl>{vanishedFile});
+    }
 };
 
 QTEST_MAIN(LocalFileListingTests)
@@ -6566,6 +6566,139 @@ void ManageAudioPlayerTest::playTrackPauseAndSkipNextTrack()
     QCOMPARE(myPlayer.playerStatus(), static_cast<int>(ManageAudioPlayer::EndOfMedia));
 }
 
+void ManageAudioPlayerTest::prepareNextTrackBeforeEndOfMedia()
+{
+    ManageAudioPlayer myPlayer;
+    QStandardItemModel myPlayList;
+
+    QSignalSpy nextPlayerSourceChangedSpy(&myPlayer, &ManageAudioPlayer::nextPlayerSourceChanged);
+    QSignalSpy prepareNextTrackSpy(&myPlayer, &ManageAudioPlayer::prepareNextTrack);
+    QSignalSpy skipNextTrackSpy(&myPlayer, &ManageAudioPlayer::skipNextTrack);
+    QSignalSpy trackSwitchLatencyChangedSpy(&myPlayer, &ManageAudioPlayer::trackSwitchLatencyChanged);
+
+    myPlayList.appendRow(new QStandardItem);
+    myPlayList.appendRow(new QStandardItem);
+
+    myPlayList.item(0, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///1.mp3")), ManageAudioPlayerTest::ResourceRole);
+    myPlayList.item(1, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///2.mp3")), ManageAudioPlayerTest::ResourceRole);
+
+    myPlayer.setPlayListModel(&myPlayList);
+    myPlayer.setUrlRole(ManageAudioPlayerTest::ResourceRole);
+    myPlayer.setIsPlayingRole(ManageAudioPlayerTest::IsPlayingRole);
+    myPlayer.setCurrentTrack(myPlayList.index(0, 0));
+
+    myPlayer.setPlayerStatus(ManageAudioPlayer::Buffered);
+    myPlayer.setPlayerPlaybackState(ManageAudioPlayer::PlayingState);
+    myPlayer.setAudioDuration(60000);
+
+    QCOMPARE(myPlayer.trackSwitchLatency(), -1);
+    QCOMPARE(trackSwitchLatencyChangedSpy.count(), 0);
+
+    myPlayer.setPlayerPosition(10000);
+
+    QCOMPARE(prepareNextTrackSpy.count(), 0);
+
+    myPlayer.setPlayerPosition(52000);
+
+    QCOMPARE(prepareNextTrackSpy.count(), 1);
+
+    myPlayer.setPlayerPosition(53000);
+
+    QCOMPARE(prepareNextTrackSpy.count(), 1);
+
+    myPlayer.setNextTrack(myPlayList.index(1, 0));
+
+    QCOMPARE(nextPlayerSourceChangedSpy.count(), 1);
+    QCOMPARE(myPlayer.nextPlayerSource(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+
+    myPlayer.setPlayerStatus(ManageAudioPlayer::EndOfMedia);
+    myPlayer.setPlayerPlaybackState(ManageAudioPlayer::StoppedState);
+
+    QVERIFY(skipNextTrackSpy.wait());
+
+    myPlayer.setCurrentTrack(myPlayList.index(1, 0));
+    myPlayer.setNextTrack({});
+
+    QCOMPARE(nextPlayerSourceChangedSpy.count(), 2);
+    QCOMPARE(myPlayer.playerSource(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+    QCOMPARE(myPlayer.nextPlayerSource(), QUrl());
+
+    myPlayer.setPlayerStatus(ManageAudioPlayer::Buffered);
+    myPlayer.setPlayerPlaybackState(ManageAudioPlayer::PlayingState);
+
+    QCOMPARE(trackSwitchLatencyChangedSpy.count(), 1);
+    QVERIFY(myPlayer.trackSwitchLatency() >= 0);
+
+    myPlayer.setPlayerPosition(55000);
+
+    QCOMPARE(prepareNextTrackSpy.count(), 2);
+}
+
+void ManageAudioPlayerTest::throttlePositionUpdates()
+{
+    ManageAudioPlayer myPlayer;
+
+    QSignalSpy playerPositionChangedSpy(&myPlayer, &ManageAudioPlayer::playerPositionChanged);
+    QSignalSpy playControlPositionChangedSpy(&myPlayer, &ManageAudioPlayer::playControlPositionChanged);
+
+    myPlayer.setPositionUpdateInterval(50);
+
+    QCOMPARE(myPlayer.positionUpdateInterval(), 50);
+
+    myPlayer.setPlayerPosition(100);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 1);
+    QCOMPARE(playControlPositionChangedSpy.count(), 1);
+    QCOMPARE(myPlayer.playControlPosition(), 100);
+
+    myPlayer.setPlayerPlaybackState(ManageAudioPlayer::PlayingState);
+
+    myPlayer.setPlayerPosition(200);
+    myPlayer.setPlayerPosition(300);
+    myPlayer.setPlayerPosition(400);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 1);
+    QCOMPARE(playControlPositionChangedSpy.count(), 1);
+    QCOMPARE(myPlayer.playerPosition(), 400);
+    QCOMPARE(myPlayer.playControlPosition(), 100);
+
+    QVERIFY(playControlPositionChangedSpy.wait());
+
+    QCOMPARE(playerPositionChangedSpy.count(), 2);
+    QCOMPARE(playControlPositionChangedSpy.count(), 2);
+    QCOMPARE(myPlayer.playControlPosition(), 400);
+
+    myPlayer.setPositionUpdatesEnabled(false);
+
+    myPlayer.setPlayerPosition(500);
+
+    QTest::qWait(150);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 2);
+    QCOMPARE(playControlPositionChangedSpy.count(), 2);
+    QCOMPARE(myPlayer.playControlPosition(), 400);
+
+    myPlayer.setPositionUpdatesEnabled(true);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 3);
+    QCOMPARE(playControlPositionChangedSpy.count(), 3);
+    QCOMPARE(myPlayer.playControlPosition(), 500);
+
+    myPlayer.playerSeek(10000);
+    myPlayer.setPlayerPosition(10000);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 4);
+    QCOMPARE(playControlPositionChangedSpy.count(), 4);
+    QCOMPARE(myPlayer.playControlPosition(), 10000);
+
+    myPlayer.setPlayerPlaybackState(ManageAudioPlayer::PausedState);
+    myPlayer.setPlayerPosition(10500);
+
+    QCOMPARE(playerPositionChangedSpy.count(), 5);
+    QCOMPARE(playControlPositionChangedSpy.count(), 5);
+    QCOMPARE(myPlayer.playControlPosition(), 10500);
+}
+
 QTEST_MAIN(ManageAudioPlayerTest)
 
 
@@ -85,6 +85,10 @@ private Q_SLOTS:
 
     void playTrackPauseAndSkipNextTrack();
 
+    void prepareNextTrackBeforeEndOfMedia();
+
+    void throttlePositionUpdates();
+
 };
 
 #endif // MANAGEAUDIOPLAYERTEST_H
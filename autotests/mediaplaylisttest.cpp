@@ -103,6 +103,9 @@ void MediaPlayListTest::initTestCase()
     qRegisterMetaType<QHash<QString,QVector<MusicAudioTrack>>>("QHash<QString,QVector<MusicAudioTrack>>");
     qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
     qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
+    qRegisterMetaType<QList<qulonglong>>("QList<qulonglong>");
+    qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
+    qRegisterMetaType<MusicAudioTrack>("MusicAudioTrack");
 }
 
 void MediaPlayListTest::simpleInitialCase()
@@ -154,8 +157,8 @@ void MediaPlayListTest::simpleInitialCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -220,6 +223,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
+    QSignalSpy newTracksByIdInListSpy(&myPlayList, &MediaPlayList::newTracksByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
 
@@ -253,8 +257,8 @@ void MediaPlayListTest::enqueueAlbumCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -275,14 +279,16 @@ void MediaPlayListTest::enqueueAlbumCase()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
+    QCOMPARE(newTracksByIdInListSpy.count(), 1);
+    QCOMPARE(newTracksByIdInListSpy.at(0).at(0).value<QList<qulonglong>>().count(), 6);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
@@ -375,8 +381,8 @@ void MediaPlayListTest::enqueueArtistCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -514,8 +520,8 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -536,14 +542,14 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
@@ -558,14 +564,14 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 1);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 1);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 7);
+    QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
@@ -625,8 +631,8 @@ void MediaPlayListTest::testHasHeader()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -850,8 +856,8 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myPlayList.enqueue({QStringLiteral("track1"), QStringLiteral("album2"), QStringLiteral("artist1")});
 
@@ -1037,8 +1043,8 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -1280,8 +1286,8 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -1518,8 +1524,8 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -1756,8 +1762,8 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -1994,8 +2000,8 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -2232,8 +2238,8 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -2502,8 +2508,8 @@ void MediaPlayListTest::enqueueClearAndEnqueue()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -2599,14 +2605,14 @@ void MediaPlayListTest::enqueueClearAndEnqueue()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 1);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 3);
     QCOMPARE(rowsRemovedSpy.count(), 1);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 2);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
@@ -2688,8 +2694,8 @@ void MediaPlayListTest::crashOnEnqueue()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
 
@@ -2787,8 +2793,8 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myPlayList.enqueue({QStringLiteral("track3"), QStringLiteral("album1"), QStringLiteral("artist3")});
 
@@ -2928,6 +2934,276 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
 
 
 
+void MediaPlayListTest::resolveTracksAfterMoveAndRemove()
+{
+    MediaPlayList myPlayList;
+
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+
+    myPlayList.enqueue({QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1")});
+    myPlayList.enqueue({QStringLiteral("track2"), QStringLiteral("album1"), QStringLiteral("artist2")});
+    myPlayList.enqueue({QStringLiteral("track3"), QStringLiteral("album1"), QStringLiteral("artist3")});
+    myPlayList.enqueue({QStringLiteral("track4"), QStringLiteral("album1"), QStringLiteral("artist4")});
+
+    QCOMPARE(myPlayList.rowCount(), 4);
+
+    myPlayList.move(0, 3, 1);
+    myPlayList.removeRows(0, 1);
+
+    QCOMPARE(myPlayList.rowCount(), 3);
+
+    dataChangedSpy.clear();
+
+    auto firstTrack = mNewTracks[0];
+    firstTrack.setDatabaseId(1);
+
+    myPlayList.trackChanged(firstTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex(), myPlayList.index(2, 0));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), true);
+
+    auto thirdTrack = mNewTracks[2];
+    thirdTrack.setDatabaseId(3);
+
+    myPlayList.trackChanged(thirdTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(dataChangedSpy.at(1).at(0).toModelIndex(), myPlayList.index(0, 0));
+
+    myPlayList.trackRemoved(firstTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 3);
+    QCOMPARE(dataChangedSpy.at(2).at(0).toModelIndex(), myPlayList.index(2, 0));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), false);
+
+    myPlayList.trackChanged(firstTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 4);
+    QCOMPARE(dataChangedSpy.at(3).at(0).toModelIndex(), myPlayList.index(2, 0));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), true);
+}
+
+void MediaPlayListTest::restorePersistentStateById()
+{
+    MediaPlayList myPlayList;
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListener(&myDatabaseContent);
+
+    QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy restoredTracksByIdInListSpy(&myPlayList, &MediaPlayList::restoredTracksByIdInList);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContentRestoreById"));
+
+    connect(&myListener, &TracksListener::trackHasChanged,
+            &myPlayList, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveBeenRestored,
+            &myPlayList, &MediaPlayList::tracksRestored,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
+            &myListener, &TracksListener::trackByNameInList,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::restoredTracksByIdInList,
+            &myListener, &TracksListener::tracksByIdInList,
+            Qt::QueuedConnection);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+    auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumArtist(QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1"));
+    auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumArtist(QStringLiteral("track4"), QStringLiteral("album1"), QStringLiteral("artist4"));
+
+    QVERIFY(firstTrackId != 0);
+    QVERIFY(fourthTrackId != 0);
+
+    myPlayList.setPersistentState({
+                                      QStringList({QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1"), QString::number(firstTrackId)}),
+                                      QStringList({QStringLiteral("track2"), QStringLiteral("album1"), QStringLiteral("artist2"), QString::number(fourthTrackId)}),
+                                      QStringList({QStringLiteral("track3"), QStringLiteral("album1"), QStringLiteral("artist3")}),
+                                  });
+
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(myPlayList.rowCount(), 3);
+    QCOMPARE(restoredTracksByIdInListSpy.count(), 1);
+    QCOMPARE(newTrackByNameInListSpy.count(), 1);
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track3"));
+
+    while (dataChangedSpy.count() < 3) {
+        QCOMPARE(dataChangedSpy.wait(), true);
+    }
+
+    QCOMPARE(newTrackByNameInListSpy.count(), 2);
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::DurationRole).toString(), QStringLiteral("00:01"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::DurationRole).toString(), QStringLiteral("00:02"));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track3"));
+
+    const auto &persistentState = myPlayList.persistentState();
+
+    QCOMPARE(persistentState.count(), 3);
+    QCOMPARE(persistentState[0].toStringList(), QStringList({QStringLiteral("track1"), QStringLiteral("album1"),
+                                                             QStringLiteral("artist1"), QString::number(firstTrackId)}));
+}
+
+void MediaPlayListTest::removeSelectionByRanges()
+{
+    MediaPlayList myPlayList;
+
+    for (int i = 1; i <= 6; ++i) {
+        myPlayList.enqueue({QStringLiteral("track") + QString::number(i), QStringLiteral("album1"), QStringLiteral("artist1")});
+    }
+
+    QSignalSpy rowsAboutToBeRemovedSpy(&myPlayList, &MediaPlayList::rowsAboutToBeRemoved);
+    QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
+    QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
+
+    myPlayList.removeSelection({4, 1, 2, 5, 2});
+
+    QCOMPARE(rowsAboutToBeRemovedSpy.count(), 2);
+    QCOMPARE(rowsRemovedSpy.count(), 2);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+
+    QCOMPARE(rowsRemovedSpy.at(0).at(1).toInt(), 4);
+    QCOMPARE(rowsRemovedSpy.at(0).at(2).toInt(), 5);
+    QCOMPARE(rowsRemovedSpy.at(1).at(1).toInt(), 1);
+    QCOMPARE(rowsRemovedSpy.at(1).at(2).toInt(), 2);
+
+    QCOMPARE(myPlayList.rowCount(), 2);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track4"));
+}
+
+void MediaPlayListTest::testHasHeaderMoveSeveralUp()
+{
+    MediaPlayList myPlayList;
+
+    myPlayList.enqueue({QStringLiteral("track1"), QStringLiteral("album1"), QStringLiteral("artist1")});
+    myPlayList.enqueue({QStringLiteral("track2"), QStringLiteral("album1"), QStringLiteral("artist1")});
+    myPlayList.enqueue({QStringLiteral("track3"), QStringLiteral("album2"), QStringLiteral("artist1")});
+    myPlayList.enqueue({QStringLiteral("track4"), QStringLiteral("album2"), QStringLiteral("artist1")});
+    myPlayList.enqueue({QStringLiteral("track5"), QStringLiteral("album3"), QStringLiteral("artist1")});
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+
+    myPlayList.moveRows({}, 3, 2, {}, 0);
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track4"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track5"));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+    QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track3"));
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), true);
+}
+
+void MediaPlayListTest::enqueueAlbumWithoutTracks()
+{
+    MediaPlayList myPlayList;
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListener(&myDatabaseContent);
+
+    QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
+    QSignalSpy newAlbumInListSpy(&myPlayList, &MediaPlayList::newAlbumInList);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+    connect(&myPlayList, &MediaPlayList::newAlbumInList,
+            &myListener, &TracksListener::newAlbumInList,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::albumTracksHaveBeenLoaded,
+            &myPlayList, &MediaPlayList::albumTracksLoaded,
+            Qt::QueuedConnection);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+    const auto fullAlbum = myDatabaseContent.albumFromTitle(QStringLiteral("album2"));
+
+    auto lazyAlbum = MusicAlbum();
+    lazyAlbum.setValid(true);
+    lazyAlbum.setDatabaseId(fullAlbum.databaseId());
+    lazyAlbum.setTitle(fullAlbum.title());
+    lazyAlbum.setArtist(fullAlbum.artist());
+    lazyAlbum.setTracksCount(fullAlbum.tracksCount());
+    lazyAlbum.setIsTracksLoaded(false);
+
+    myPlayList.enqueue(lazyAlbum);
+
+    QCOMPARE(newAlbumInListSpy.count(), 1);
+    QCOMPARE(newAlbumInListSpy.at(0).at(0).toULongLong(), fullAlbum.databaseId());
+    QCOMPARE(rowsInsertedSpy.count(), 0);
+    QCOMPARE(myPlayList.rowCount(), 0);
+
+    QCOMPARE(rowsInsertedSpy.wait(), true);
+
+    QCOMPARE(myPlayList.rowCount(), 6);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayList.data(myPlayList.index(5, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track6"));
+
+    myPlayList.enqueue(lazyAlbum);
+    myPlayList.clearPlayList();
+
+    QCOMPARE(newAlbumInListSpy.count(), 2);
+    QCOMPARE(rowsInsertedSpy.wait(300), false);
+    QCOMPARE(myPlayList.rowCount(), 0);
+}
+
+void MediaPlayListTest::resolveDuplicatePendingTracksByName()
+{
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListener(&myDatabaseContent);
+
+    QSignalSpy trackHasChangedSpy(&myListener, &TracksListener::trackHasChanged);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContentPendingByName"));
+
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
+
+    myListener.trackByNameInList(QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"));
+    myListener.trackByNameInList(QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"));
+    myListener.trackByNameInList(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"));
+    myListener.trackByNameInList(QStringLiteral("unknownTrack"), QStringLiteral("artist1"), QStringLiteral("album2"));
+
+    QCOMPARE(trackHasChangedSpy.count(), 0);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+
+    QCOMPARE(trackHasChangedSpy.count(), 3);
+
+    const auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumArtist(QStringLiteral("track3"), QStringLiteral("album1"), QStringLiteral("artist3"));
+    const auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumArtist(QStringLiteral("track2"), QStringLiteral("album2"), QStringLiteral("artist1"));
+
+    auto resolvedTracksIds = QList<qulonglong>();
+    for (const auto &oneSignal : trackHasChangedSpy) {
+        resolvedTracksIds.push_back(oneSignal.at(0).value<MusicAudioTrack>().databaseId());
+    }
+
+    QCOMPARE(resolvedTracksIds.count(firstTrackId), 2);
+    QCOMPARE(resolvedTracksIds.count(secondTrackId), 1);
+
+    myDatabaseContent.insertTracksList({mNewTracks.first()}, mNewCovers, QStringLiteral("autoTest"));
+
+    QCOMPARE(trackHasChangedSpy.count(), 3);
+}
+
 CrashEnqueuePlayList::CrashEnqueuePlayList(MediaPlayList *list, QObject *parent) : QObject(parent), mList(list)
 {
 }
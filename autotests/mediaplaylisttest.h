@@ -73,6 +73,18 @@ private Q_SLOTS:
 
     void restoreMultipleIdenticalTracks();
 
+    void resolveTracksAfterMoveAndRemove();
+
+    void restorePersistentStateById();
+
+    void removeSelectionByRanges();
+
+    void testHasHeaderMoveSeveralUp();
+
+    void enqueueAlbumWithoutTracks();
+
+    void resolveDuplicatePendingTracksByName();
+
 private:
 
     QList<MusicAudioTrack> mNewTracks;
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "musicaudiotrack.h"
+#include "trackgenerator.h"
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QFile>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class MusicAudioTrackMemoryBenchmark: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static qint64 residentMemory()
+    {
+        QFile statusFile(QStringLiteral("/proc/self/status"));
+
+        if (!statusFile.open(QIODevice::ReadOnly)) {
+            return -1;
+        }
+
+        while (!statusFile.atEnd()) {
+            const auto oneLine = statusFile.readLine();
+
+            if (oneLine.startsWith("VmRSS:")) {
+                return oneLine.mid(6).trimmed().split(' ').first().toLongLong() * 1024;
+            }
+        }
+
+        return -1;
+    }
+
+private Q_SLOTS:
+
+    void bytesPerTrack_data()
+    {
+        QTest::addColumn<int>("tracksCount");
+
+        QTest::newRow("20k tracks") << 20000;
+        QTest::newRow("200k tracks") << 200000;
+    }
+
+    void bytesPerTrack()
+    {
+        QFETCH(int, tracksCount);
+
+        const auto initialMemory = residentMemory();
+
+        if (initialMemory < 0) {
+            QSKIP("resident memory is only measured through /proc/self/status");
+        }
+
+        const auto allTracks = generateTracks(tracksCount);
+
+        const auto libraryMemory = residentMemory();
+
+        const auto albumsCopy = allTracks;
+        const auto modelCopy = allTracks;
+        const auto playListCopy = allTracks;
+
+        auto copiedTracksCount = 0;
+        for (const auto &oneTrack : albumsCopy) {
+            copiedTracksCount += (oneTrack.isValid() ? 1 : 0);
+        }
+
+        const auto copiesMemory = residentMemory();
+
+        qDebug() << "MusicAudioTrackMemoryBenchmark::bytesPerTrack" << tracksCount << "tracks,"
+                 << (libraryMemory - initialMemory) / tracksCount << "bytes per track,"
+                 << (copiesMemory - libraryMemory) / tracksCount << "bytes per track for three more copies";
+
+        QCOMPARE(copiedTracksCount, tracksCount);
+        QCOMPARE(modelCopy.count(), tracksCount);
+        QCOMPARE(playListCopy.count(), tracksCount);
+    }
+};
+
+QTEST_MAIN(MusicAudioTrackMemoryBenchmark)
+
+
+#include "musicaudiotrackmemorybenchmark.moc"
@@ -28,6 +28,9 @@
 
 #include <QVariant>
 #include <QList>
+#include <QSet>
+#include <QStringList>
+#include <QStringListModel>
 
 #include <QtTest>
 
@@ -77,8 +80,8 @@ void PlayListControlerTest::testBringUpCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(playListModelChangedSpy.count(), 0);
@@ -223,8 +226,8 @@ void PlayListControlerTest::testBringUpCaseFromNewAlbum()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(playListModelChangedSpy.count(), 0);
@@ -359,8 +362,8 @@ void PlayListControlerTest::testBringUpAndDownCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(playListModelChangedSpy.count(), 0);
@@ -519,8 +522,8 @@ void PlayListControlerTest::testBringUpAndRemoveCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -670,8 +673,8 @@ void PlayListControlerTest::testBringUpAndRemoveMultipleCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -832,8 +835,8 @@ void PlayListControlerTest::testBringUpAndRemoveMultipleNotBeginCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1018,8 +1021,8 @@ void PlayListControlerTest::testBringUpAndPlayCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1170,8 +1173,8 @@ void PlayListControlerTest::testBringUpAndSkipNextCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1322,8 +1325,8 @@ void PlayListControlerTest::testBringUpAndSkipPreviousCase()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1487,8 +1490,8 @@ void PlayListControlerTest::finishPlayList()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1652,8 +1655,8 @@ void PlayListControlerTest::randomPlayList()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -1794,7 +1797,7 @@ void PlayListControlerTest::randomPlayList()
     QCOMPARE(repeatPlayControlChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(0, 0)));
+    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(3, 0)));
 
     myControler.skipNextTrack();
 
@@ -1807,7 +1810,7 @@ void PlayListControlerTest::randomPlayList()
     QCOMPARE(repeatPlayControlChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(3, 0)));
+    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(1, 0)));
 
     myControler.skipNextTrack();
 
@@ -1831,9 +1834,134 @@ void PlayListControlerTest::randomPlayList()
     QCOMPARE(randomPlayControlChangedSpy.count(), 1);
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(repeatPlayControlChangedSpy.count(), 0);
-    QCOMPARE(playListFinishedSpy.count(), 0);
+    QCOMPARE(playListFinishedSpy.count(), 1);
 
-    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(0, 0)));
+    QCOMPARE(myControler.currentTrack(), QPersistentModelIndex(myPlayList.index(1, 0)));
+}
+
+void PlayListControlerTest::randomPlayListVisitsEachTrackOnce()
+{
+    PlayListControler myControler;
+    QStringListModel myPlayList;
+
+    QSignalSpy playListFinishedSpy(&myControler, &PlayListControler::playListFinished);
+
+    auto allTracks = QStringList();
+    for (int i = 0; i < 100; ++i) {
+        allTracks.push_back(QStringLiteral("track") + QString::number(i));
+    }
+    myPlayList.setStringList(allTracks);
+
+    myControler.setPlayListModel(&myPlayList);
+    myControler.seedRandomGenerator(0);
+    myControler.setRandomPlay(true);
+
+    QCOMPARE(myControler.currentTrackRow(), 0);
+
+    auto playedTracks = QStringList{myControler.currentTrack().data().toString()};
+
+    for (int i = 0; i < 49; ++i) {
+        myControler.skipNextTrack();
+        playedTracks.push_back(myControler.currentTrack().data().toString());
+    }
+
+    QCOMPARE(playedTracks.toSet().size(), playedTracks.size());
+
+    for (int i = playedTracks.size() - 2; i >= 0; --i) {
+        myControler.skipPreviousTrack();
+        QCOMPARE(myControler.currentTrack().data().toString(), playedTracks[i]);
+    }
+
+    myControler.skipPreviousTrack();
+
+    QCOMPARE(myControler.currentTrack().data().toString(), playedTracks.first());
+
+    for (int i = 1; i < playedTracks.size(); ++i) {
+        myControler.skipNextTrack();
+        QCOMPARE(myControler.currentTrack().data().toString(), playedTracks[i]);
+    }
+
+    QVERIFY(myPlayList.insertRows(0, 10));
+    for (int i = 0; i < 10; ++i) {
+        myPlayList.setData(myPlayList.index(i, 0), QStringLiteral("newTrack") + QString::number(i));
+    }
+
+    const auto firstRemovedRow = (myControler.currentTrackRow() > 50 ? 0 : 60);
+    auto removedTracks = QStringList();
+    for (int i = firstRemovedRow; i < firstRemovedRow + 5; ++i) {
+        removedTracks.push_back(myPlayList.index(i, 0).data().toString());
+    }
+
+    QVERIFY(myPlayList.removeRows(firstRemovedRow, 5));
+
+    for (int i = 0; i < myPlayList.rowCount() && playListFinishedSpy.isEmpty(); ++i) {
+        myControler.skipNextTrack();
+        if (playListFinishedSpy.isEmpty()) {
+            playedTracks.push_back(myControler.currentTrack().data().toString());
+        }
+    }
+
+    QCOMPARE(playListFinishedSpy.count(), 1);
+
+    for (const auto &oneTrack : removedTracks) {
+        playedTracks.removeAll(oneTrack);
+    }
+
+    QCOMPARE(playedTracks.size(), myPlayList.rowCount());
+    QCOMPARE(playedTracks.toSet(), myPlayList.stringList().toSet());
+}
+
+void PlayListControlerTest::prepareNextTrack()
+{
+    PlayListControler myControler;
+    QStringListModel myPlayList;
+
+    QSignalSpy nextTrackChangedSpy(&myControler, &PlayListControler::nextTrackChanged);
+
+    myPlayList.setStringList({QStringLiteral("track1"), QStringLiteral("track2"), QStringLiteral("track3")});
+
+    myControler.setPlayListModel(&myPlayList);
+
+    QCOMPARE(myControler.currentTrackRow(), 0);
+    QCOMPARE(myControler.nextTrack(), QPersistentModelIndex());
+
+    myControler.prepareNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 1);
+    QCOMPARE(myControler.nextTrack(), QPersistentModelIndex(myPlayList.index(1, 0)));
+
+    myControler.skipNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 2);
+    QCOMPARE(myControler.currentTrackRow(), 1);
+    QCOMPARE(myControler.nextTrack(), QPersistentModelIndex());
+
+    myControler.skipNextTrack();
+    myControler.prepareNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 2);
+    QCOMPARE(myControler.currentTrackRow(), 2);
+    QCOMPARE(myControler.nextTrack(), QPersistentModelIndex());
+
+    myControler.seedRandomGenerator(0);
+    myControler.setRandomPlay(true);
+
+    myControler.prepareNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 3);
+    QVERIFY(myControler.nextTrack().isValid());
+    QVERIFY(myControler.nextTrack().row() != 2);
+
+    const auto preparedTrack = myControler.nextTrack();
+
+    myControler.prepareNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 3);
+
+    myControler.skipNextTrack();
+
+    QCOMPARE(nextTrackChangedSpy.count(), 4);
+    QCOMPARE(myControler.currentTrack(), preparedTrack);
 }
 
 void PlayListControlerTest::continuePlayList()
@@ -1870,8 +1998,8 @@ void PlayListControlerTest::continuePlayList()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -2088,8 +2216,8 @@ void PlayListControlerTest::testRestoreSettings()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -2236,8 +2364,8 @@ void PlayListControlerTest::removeBeforeCurrentTrack()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -2424,8 +2552,8 @@ void PlayListControlerTest::switchToTrackTest()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
@@ -2579,8 +2707,8 @@ void PlayListControlerTest::singleTrack()
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
-    connect(&myDatabaseContent, &DatabaseInterface::trackAdded,
-            &myListener, &TracksListener::trackAdded);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
 
     myControler.setPlayListModel(&myPlayList);
 
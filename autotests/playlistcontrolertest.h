@@ -59,6 +59,10 @@ private Q_SLOTS:
 
     void randomPlayList();
 
+    void randomPlayListVisitsEachTrackOnce();
+
+    void prepareNextTrack();
+
     void continuePlayList();
 
     void testRestoreSettings();
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "progressindicatortest.h"
+
+#include "progressindicator.h"
+
+#include <QtTest>
+
+ProgressIndicatorTest::ProgressIndicatorTest(QObject *parent) : QObject(parent)
+{
+}
+
+void ProgressIndicatorTest::formatProgressDuration_data()
+{
+    QTest::addColumn<int>("position");
+    QTest::addColumn<QString>("progressDuration");
+
+    QTest::newRow("start") << 0 << QStringLiteral("0:00");
+    QTest::newRow("seconds") << 7999 << QStringLiteral("0:07");
+    QTest::newRow("minutes") << 65000 << QStringLiteral("1:05");
+    QTest::newRow("ten minutes") << 754000 << QStringLiteral("12:34");
+    QTest::newRow("one hour") << 3723000 << QStringLiteral("1:02:03");
+    QTest::newRow("more than a day") << 446130000 << QStringLiteral("123:55:30");
+}
+
+void ProgressIndicatorTest::formatProgressDuration()
+{
+    QFETCH(int, position);
+    QFETCH(QString, progressDuration);
+
+    ProgressIndicator myIndicator;
+
+    myIndicator.setPosition(position);
+
+    QCOMPARE(myIndicator.position(), position);
+    QCOMPARE(myIndicator.progressDuration(), progressDuration);
+}
+
+void ProgressIndicatorTest::skipUnchangedSeconds()
+{
+    ProgressIndicator myIndicator;
+
+    QSignalSpy positionChangedSpy(&myIndicator, &ProgressIndicator::positionChanged);
+    QSignalSpy progressDurationChangedSpy(&myIndicator, &ProgressIndicator::progressDurationChanged);
+
+    myIndicator.setPosition(1000);
+
+    QCOMPARE(positionChangedSpy.count(), 1);
+    QCOMPARE(progressDurationChangedSpy.count(), 1);
+    QCOMPARE(myIndicator.progressDuration(), QStringLiteral("0:01"));
+
+    myIndicator.setPosition(1500);
+
+    QCOMPARE(positionChangedSpy.count(), 2);
+    QCOMPARE(progressDurationChangedSpy.count(), 1);
+    QCOMPARE(myIndicator.progressDuration(), QStringLiteral("0:01"));
+
+    myIndicator.setPosition(1500);
+
+    QCOMPARE(positionChangedSpy.count(), 2);
+    QCOMPARE(progressDurationChangedSpy.count(), 1);
+
+    myIndicator.setPosition(2000);
+
+    QCOMPARE(positionChangedSpy.count(), 3);
+    QCOMPARE(progressDurationChangedSpy.count(), 2);
+    QCOMPARE(myIndicator.progressDuration(), QStringLiteral("0:02"));
+}
+
+QTEST_MAIN(ProgressIndicatorTest)
+
+
+#include "moc_progressindicatortest.cpp"
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef TRACKGENERATOR_H
+#define TRACKGENERATOR_H
+
+#include "musicaudiotrack.h"
+
+#include <QUrl>
+#include <QString>
+#include <QList>
+#include <QTime>
+
+// albums of 12 tracks, artists of 8 albums
+inline QList<MusicAudioTrack> generateTracks(int tracksCount)
+{
+    auto result = QList<MusicAudioTrack>();
+    result.reserve(tracksCount);
+
+    for (int i = 0; i < tracksCount; ++i) {
+        const auto albumIndex = i / 12;
+        const auto artistIndex = albumIndex / 8;
+
+        const auto trackNumber = i % 12 + 1;
+        const auto artistName = QStringLiteral("artist") + QString::number(artistIndex);
+        const auto albumName = QStringLiteral("album") + QString::number(albumIndex);
+
+        result.push_back({true, QStringLiteral("$") + QString::number(i), QStringLiteral("0"),
+                          QStringLiteral("track") + QString::number(trackNumber), artistName, albumName, artistName,
+                          trackNumber, 1, QTime::fromMSecsSinceStartOfDay(180000 + i % 60000),
+                          {QUrl::fromLocalFile(QStringLiteral("/music/") + albumName + QStringLiteral("/") + QString::number(i) + QStringLiteral(".ogg"))},
+                          {QUrl::fromLocalFile(QStringLiteral("/music/") + albumName + QStringLiteral("/cover.jpg"))}, i % 6});
+    }
+
+    return result;
+}
+
+#endif // TRACKGENERATOR_H
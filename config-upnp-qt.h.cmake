@@ -22,6 +22,8 @@
 
 #cmakedefine01 Qt5AndroidExtras_FOUND
 
+#cmakedefine01 HAVE_INOTIFY
+
 #define LOCAL_FILE_TESTS_SAMPLE_FILES_PATH "@CMAKE_CURRENT_SOURCE_DIR@/autotests/data"
 
 #define LOCAL_FILE_TESTS_WORKING_PATH "@CMAKE_CURRENT_BINARY_DIR@/autotests/data"
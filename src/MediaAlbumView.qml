@@ -64,19 +64,20 @@ Item {
     AlbumModel {
         id: contentModel
 
+        database: musicListener.viewDatabase
         albumData: topListing.albumData
     }
 
     Connections {
         target: musicListener
 
-        onAlbumRemoved: contentModel.albumRemoved(removedAlbum)
+        onAlbumsRemoved: contentModel.albumsRemoved(removedAlbums)
     }
 
     Connections {
         target: musicListener
 
-        onAlbumModified: contentModel.albumModified(modifiedAlbum)
+        onAlbumsModified: contentModel.albumsModified(modifiedAlbums)
     }
 
     ColumnLayout {
@@ -137,8 +137,8 @@ Item {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: AlbumFilterProxyModel {
-                            sourceModel: rootElement.contentDirectoryModel
+                        model: AllAlbumsModel {
+                            database: rootElement.musicListener.viewDatabase
 
                             filterText: filterTextInput.text
 
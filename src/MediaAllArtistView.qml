@@ -146,6 +146,8 @@ Item {
                                   else
                                       ""
 
+                            databaseId: model.databaseId
+
                             stackView: rootElement.stackView
 
                             playListModel: rootElement.playListModel
@@ -37,6 +37,7 @@ Item {
     property var contentDirectoryModel
 
     property alias artistName: navBar.artist
+    property var artistId
 
     id: rootElement
 
@@ -115,11 +116,10 @@ Item {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: SortFilterProxyModel {
-                            sourceModel: contentDirectoryModel
-                            filterRole: AllAlbumsModel.AllArtistsRole
+                        model: AllAlbumsModel {
+                            database: rootElement.musicListener.viewDatabase
 
-                            filterRegExp: new RegExp('.*' + artistName + '.*', 'i')
+                            artistId: rootElement.artistId
                         }
 
                         delegate: MediaAlbumDelegate {
@@ -36,6 +36,7 @@ Rectangle {
     property var contentDirectoryModel
     property var image
     property alias name: nameLabel.text
+    property var databaseId
 
     id: mediaServerEntry
 
@@ -67,10 +68,12 @@ Rectangle {
                                properties :
                                {
                                    playListModel: mediaServerEntry.playListModel,
+                                   musicListener: mediaServerEntry.musicListener,
                                    contentDirectoryModel: mediaServerEntry.contentDirectoryModel,
                                    playerControl: mediaServerEntry.playerControl,
                                    stackView: mediaServerEntry.stackView,
                                    artistName: name,
+                                   artistId: databaseId,
                                }})
         }
     }
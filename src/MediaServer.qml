@@ -139,6 +139,7 @@ ApplicationWindow {
         onMutedChanged: playControlItem.muted = muted
 
         source: manageAudioPlayer.playerSource
+        nextSource: manageAudioPlayer.nextPlayerSource
 
         onPlaying: {
             myPlayControlManager.playerPlaying()
@@ -196,6 +197,7 @@ ApplicationWindow {
         id: manageAudioPlayer
 
         currentTrack: playListControlerItem.currentTrack
+        nextTrack: playListControlerItem.nextTrack
         playListModel: playListModelItem
         urlRole: MediaPlayList.ResourceRole
         isPlayingRole: MediaPlayList.IsPlayingRole
@@ -206,6 +208,7 @@ ApplicationWindow {
         audioDuration: audioPlayer.duration
         playerIsSeekable: audioPlayer.seekable
         playerPosition: audioPlayer.position
+        positionUpdatesEnabled: mainWindow.visibility !== Window.Hidden && mainWindow.visibility !== Window.Minimized
 
         persistentState: persistentSettings.audioPlayerState
 
@@ -213,6 +216,7 @@ ApplicationWindow {
         onPlayerPause: audioPlayer.pause()
         onPlayerStop: audioPlayer.stop()
         onSkipNextTrack: playListControlerItem.skipNextTrack()
+        onPrepareNextTrack: playListControlerItem.prepareNextTrack()
         onSeek: audioPlayer.seek(position)
     }
 
@@ -225,46 +229,26 @@ ApplicationWindow {
 
     AllAlbumsModel {
         id: allAlbumsModel
-    }
-
-    Connections {
-        target: allListeners
-
-        onAlbumAdded: allAlbumsModel.albumAdded(newAlbum)
-    }
-
-    Connections {
-        target: allListeners
 
-        onAlbumRemoved: allAlbumsModel.albumRemoved(removedAlbum)
-    }
-
-    Connections {
-        target: allListeners
-
-        onAlbumModified: allAlbumsModel.albumModified(modifiedAlbum)
+        database: allListeners.viewDatabase
     }
 
     AllArtistsModel {
         id: allArtistsModel
-    }
-
-    Connections {
-        target: allListeners
 
-        onArtistAdded: allArtistsModel.artistAdded(newArtist)
+        database: allListeners.viewDatabase
     }
 
     Connections {
         target: allListeners
 
-        onArtistRemoved: allArtistsModel.artistRemoved(removedArtist)
+        onArtistsAdded: allArtistsModel.artistsAdded(newArtists)
     }
 
     Connections {
         target: allListeners
 
-        onArtistModified: allArtistsModel.artistModified(modifiedArtist)
+        onArtistsRemoved: allArtistsModel.artistsRemoved(removedArtists)
     }
 
     Menu {
@@ -390,7 +374,7 @@ ApplicationWindow {
 
                 volume: persistentSettings.playControlItemVolume
                 muted: persistentSettings.playControlItemMuted
-                position: audioPlayer.position
+                position: manageAudioPlayer.playControlPosition
                 skipBackwardEnabled: myPlayControlManager.skipBackwardControlEnabled
                 skipForwardEnabled: myPlayControlManager.skipForwardControlEnabled
                 playEnabled: myPlayControlManager.playControlEnabled
@@ -401,7 +385,7 @@ ApplicationWindow {
                 Layout.maximumHeight: Layout.preferredHeight
                 Layout.fillWidth: true
 
-                onSeek: audioPlayer.seek(position)
+                onSeek: manageAudioPlayer.playerSeek(position)
 
                 onPlay: manageAudioPlayer.playPause()
                 onPause: manageAudioPlayer.playPause()
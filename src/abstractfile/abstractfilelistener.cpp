@@ -63,6 +63,8 @@ void AbstractFileListener::setDatabaseInterface(DatabaseInterface *model)
         connect(d->mFileListing, &AbstractFileListing::tracksList, model, &DatabaseInterface::insertTracksList);
         connect(d->mFileListing, &AbstractFileListing::removedTracksList, model, &DatabaseInterface::removeTracksList);
         connect(d->mFileListing, &AbstractFileListing::modifyTracksList, model, &DatabaseInterface::modifyTracksList);
+        connect(d->mFileListing, &AbstractFileListing::askRestoredTracks, model, &DatabaseInterface::askRestoredTracks);
+        connect(model, &DatabaseInterface::restoredTracks, d->mFileListing, &AbstractFileListing::restoredTracks);
 
         QMetaObject::invokeMethod(d->mFileListing, "init", Qt::QueuedConnection);
     }
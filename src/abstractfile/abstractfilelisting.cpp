@@ -19,6 +19,7 @@
 
 #include "abstractfilelisting.h"
 
+#include "directorymonitor.h"
 #include "musicaudiotrack.h"
 
 #include <KFileMetaData/Properties>
@@ -31,26 +32,98 @@
 #include <QHash>
 #include <QFileInfo>
 #include <QDir>
-#include <QFileSystemWatcher>
 #include <QMimeDatabase>
 #include <QSet>
 #include <QPair>
+#include <QThreadPool>
+#include <QThreadStorage>
+#include <QRunnable>
 
 #include <algorithm>
 
+static MusicAudioTrack extractOneFile(const QUrl &scanFile, KFileMetaData::ExtractorCollection &extractors);
+
+class MetaDataExtractionTask : public QRunnable
+{
+public:
+
+    MetaDataExtractionTask(const QPair<QUrl, QUrl> *files, MusicAudioTrack *tracks, int count)
+        : mFiles(files), mTracks(tracks), mCount(count)
+    {
+    }
+
+    void run() override
+    {
+        static QThreadStorage<KFileMetaData::ExtractorCollection*> threadExtractors;
+
+        if (!threadExtractors.hasLocalData()) {
+            threadExtractors.setLocalData(new KFileMetaData::ExtractorCollection);
+        }
+
+        auto &extractors = *threadExtractors.localData();
+
+        for (int i = 0; i < mCount; ++i) {
+            mTracks[i] = extractOneFile(mFiles[i].first, extractors);
+        }
+    }
+
+private:
+
+    const QPair<QUrl, QUrl> *mFiles;
+
+    MusicAudioTrack *mTracks;
+
+    int mCount;
+
+};
+
+class DiscoveredDirectory
+{
+public:
+
+    bool contains(const QString &path) const
+    {
+        auto itEntry = std::lower_bound(mEntries.begin(), mEntries.end(), path, entryLessThan);
+
+        return itEntry != mEntries.end() && itEntry->first == path;
+    }
+
+    void insert(const QString &path, bool isFile)
+    {
+        auto itEntry = std::lower_bound(mEntries.begin(), mEntries.end(), path, entryLessThan);
+
+        if (itEntry != mEntries.end() && itEntry->first == path) {
+            itEntry->second = isFile;
+            return;
+        }
+
+        mEntries.insert(itEntry, {path, isFile});
+    }
+
+    static bool entryLessThan(const QPair<QString, bool> &entry, const QString &path)
+    {
+        return entry.first < path;
+    }
+
+    QVector<QPair<QString, bool>> mEntries;
+
+};
+
 class AbstractFileListingPrivate
 {
 public:
 
-    explicit AbstractFileListingPrivate(const QString &sourceName) : mSourceName(sourceName)
+    AbstractFileListingPrivate(const QString &sourceName, QObject *owner) : mDirectoryMonitor(owner), mSourceName(sourceName)
     {
     }
 
-    QFileSystemWatcher mFileSystemWatcher;
+    DirectoryMonitor mDirectoryMonitor;
 
     QHash<QString, QUrl> mAllAlbumCover;
 
-    QHash<QUrl, QSet<QPair<QUrl, bool>>> mDiscoveredFiles;
+    QHash<QUrl, DiscoveredDirectory> mDiscoveredFiles;
+
+    QHash<QUrl, QPair<qint64, QDateTime>> mRestoredFiles;
 
     QString mSourceName;
 
@@ -58,14 +131,22 @@ public:
 
     KFileMetaData::ExtractorCollection mExtractors;
 
+    QThreadPool mExtractionPool;
+
+    int mExtractionBatchSize = 1000;
+
+    int mExtractionTaskSize = 16;
+
 };
 
-AbstractFileListing::AbstractFileListing(const QString &sourceName, QObject *parent) : QObject(parent), d(new AbstractFileListingPrivate(sourceName))
+AbstractFileListing::AbstractFileListing(const QString &sourceName, QObject *parent) : QObject(parent), d(new AbstractFileListingPrivate(sourceName, this))
 {
-    connect(&d->mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
-            this, &AbstractFileListing::directoryChanged);
-    connect(&d->mFileSystemWatcher, &QFileSystemWatcher::fileChanged,
-            this, &AbstractFileListing::fileChanged);
+    d->mExtractionPool.setMaxThreadCount(QThread::idealThreadCount());
+
+    connect(&d->mDirectoryMonitor, &DirectoryMonitor::directoriesChanged,
+            this, &AbstractFileListing::directoriesChanged);
+    connect(&d->mDirectoryMonitor, &DirectoryMonitor::filesModified,
+            this, &AbstractFileListing::filesModified);
 }
 
 AbstractFileListing::~AbstractFileListing()
@@ -79,7 +160,24 @@ void AbstractFileListing::init()
 
 void AbstractFileListing::databaseIsReady()
 {
+    Q_EMIT askRestoredTracks(d->mSourceName);
+}
+
+void AbstractFileListing::restoredTracks(const QString &musicSource, const QHash<QUrl, QPair<qint64, QDateTime>> &allFiles)
+{
+    if (musicSource != d->mSourceName) {
+        return;
+    }
+
+    d->mRestoredFiles = allFiles;
+
     refreshContent();
+
+    if (d->mHandleNewFiles && !d->mRestoredFiles.isEmpty()) {
+        Q_EMIT removedTracksList(d->mRestoredFiles.keys());
+    }
+
+    d->mRestoredFiles.clear();
 }
 
 void AbstractFileListing::newTrackFile(const MusicAudioTrack &partialTrack)
@@ -95,7 +193,21 @@ void AbstractFileListing::applicationAboutToQuit()
 {
 }
 
-void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path)
+int AbstractFileListing::extractionThreadCount() const
+{
+    return d->mExtractionPool.maxThreadCount();
+}
+
+void AbstractFileListing::setExtractionThreadCount(int value)
+{
+    if (value <= 0) {
+        return;
+    }
+
+    d->mExtractionPool.setMaxThreadCount(value);
+}
+
+void AbstractFileListing::scanDirectory(QVector<QPair<QUrl, QUrl>> &newFiles, const QUrl &path)
 {
     QDir rootDirectory(path.toLocalFile());
     rootDirectory.refresh();
@@ -104,43 +216,61 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
         watchPath(path.toLocalFile());
     }
 
-    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
+    const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
 
-    auto currentFilesList = QSet<QUrl>();
+    auto currentEntries = QVector<QPair<QString, int>>();
+    currentEntries.reserve(entryList.size());
 
-    rootDirectory.refresh();
-    const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
-    for (const auto &oneEntry : entryList) {
-        auto newFilePath = QUrl::fromLocalFile(oneEntry.canonicalFilePath());
+    for (int i = 0; i < entryList.size(); ++i) {
+        const auto &oneEntry = entryList[i];
 
         if (oneEntry.isDir() || oneEntry.isFile()) {
-            currentFilesList.insert(newFilePath);
+            currentEntries.push_back({oneEntry.canonicalFilePath(), i});
         }
     }
 
-    auto removedTracks = QVector<QPair<QUrl, bool>>();
-    for (const auto &removedFilePath : currentDirectoryListingFiles) {
-        auto itFilePath = std::find(currentFilesList.begin(), currentFilesList.end(), removedFilePath.first);
+    std::sort(currentEntries.begin(), currentEntries.end());
 
-        if (itFilePath != currentFilesList.end()) {
-            continue;
-        }
+    auto &currentDirectory = d->mDiscoveredFiles[path];
+
+    auto keptEntries = QVector<QPair<QString, bool>>();
+    keptEntries.reserve(currentDirectory.mEntries.size());
 
-        removedTracks.push_back(removedFilePath);
+    auto removedEntries = QVector<QPair<QString, bool>>();
+    auto addedEntries = QVector<int>();
+
+    auto itKnown = currentDirectory.mEntries.cbegin();
+    auto itCurrent = currentEntries.cbegin();
+
+    while (itKnown != currentDirectory.mEntries.cend() || itCurrent != currentEntries.cend()) {
+        if (itCurrent == currentEntries.cend() || (itKnown != currentDirectory.mEntries.cend() && itKnown->first < itCurrent->first)) {
+            removedEntries.push_back(*itKnown);
+            ++itKnown;
+        } else if (itKnown == currentDirectory.mEntries.cend() || itCurrent->first < itKnown->first) {
+            addedEntries.push_back(itCurrent->second);
+            ++itCurrent;
+        } else {
+            if (itKnown->second == entryList[itCurrent->second].isFile()) {
+                keptEntries.push_back(*itKnown);
+            } else {
+                removedEntries.push_back(*itKnown);
+                addedEntries.push_back(itCurrent->second);
+            }
+            ++itKnown;
+            ++itCurrent;
+        }
     }
 
+    currentDirectory.mEntries = keptEntries;
+
     auto allRemovedTracks = QList<QUrl>();
-    for (const auto &oneRemovedTrack : removedTracks) {
-        if (oneRemovedTrack.second) {
-            allRemovedTracks.push_back(oneRemovedTrack.first);
+    for (const auto &oneRemovedEntry : removedEntries) {
+        if (oneRemovedEntry.second) {
+            allRemovedTracks.push_back(QUrl::fromLocalFile(oneRemovedEntry.first));
         } else {
-            removeFile(oneRemovedTrack.first, allRemovedTracks);
+            removeFile(QUrl::fromLocalFile(oneRemovedEntry.first), allRemovedTracks);
         }
     }
-    for (const auto &oneRemovedTrack : removedTracks) {
-        currentDirectoryListingFiles.remove(oneRemovedTrack);
-        currentDirectoryListingFiles.remove(oneRemovedTrack);
-    }
 
     if (!allRemovedTracks.isEmpty()) {
         Q_EMIT removedTracksList(allRemovedTracks);
@@ -150,31 +280,76 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
         return;
     }
 
-    for (const auto &newFilePath : currentFilesList) {
-        QFileInfo oneEntry(newFilePath.toLocalFile());
-
-        auto itFilePath = std::find(currentDirectoryListingFiles.begin(), currentDirectoryListingFiles.end(), QPair<QUrl, bool>{newFilePath, oneEntry.isFile()});
-
-        if (itFilePath != currentDirectoryListingFiles.end()) {
-            continue;
-        }
+    for (auto oneAddedEntry : addedEntries) {
+        const auto &oneEntry = entryList[oneAddedEntry];
+        const auto newFilePath = QUrl::fromLocalFile(oneEntry.canonicalFilePath());
 
         if (oneEntry.isDir()) {
-            addFileInDirectory(newFilePath, path);
+            addFileInDirectory(newFilePath, path, false);
             scanDirectory(newFiles, newFilePath);
             continue;
         }
-        if (!oneEntry.isFile()) {
-            continue;
+
+        auto itRestoredFile = d->mRestoredFiles.find(newFilePath);
+        if (itRestoredFile != d->mRestoredFiles.end()) {
+            const auto isUnchanged = itRestoredFile->first == oneEntry.size() && itRestoredFile->second == oneEntry.lastModified();
+
+            d->mRestoredFiles.erase(itRestoredFile);
+
+            if (isUnchanged) {
+                addFileInDirectory(newFilePath, path, true);
+                continue;
+            }
         }
 
-        auto newTrack = scanOneFile(newFilePath);
+        newFiles.push_back({newFilePath, path});
+    }
+}
+
+void AbstractFileListing::extractNewFiles(const QVector<QPair<QUrl, QUrl>> &newFiles)
+{
+    auto extractedTracks = QVector<MusicAudioTrack>();
+
+    for (int batchStart = 0; batchStart < newFiles.size(); batchStart += d->mExtractionBatchSize) {
+        const auto batchCount = std::min(d->mExtractionBatchSize, newFiles.size() - batchStart);
+
+        extractedTracks.fill(MusicAudioTrack(), batchCount);
+
+        if (d->mExtractionPool.maxThreadCount() > 1) {
+            auto extractedTracksData = extractedTracks.data();
+
+            for (int taskStart = 0; taskStart < batchCount; taskStart += d->mExtractionTaskSize) {
+                const auto taskCount = std::min(d->mExtractionTaskSize, batchCount - taskStart);
+
+                d->mExtractionPool.start(new MetaDataExtractionTask(newFiles.constData() + batchStart + taskStart,
+                                                                    extractedTracksData + taskStart, taskCount));
+            }
+
+            d->mExtractionPool.waitForDone();
+        } else {
+            for (int i = 0; i < batchCount; ++i) {
+                extractedTracks[i] = extractOneFile(newFiles[batchStart + i].first, d->mExtractors);
+            }
+        }
+
+        auto batchTracks = QList<MusicAudioTrack>();
+        batchTracks.reserve(batchCount);
+
+        for (int i = 0; i < batchCount; ++i) {
+            const auto &newTrack = extractedTracks[i];
+
+            if (!newTrack.isValid()) {
+                continue;
+            }
 
-        if (newTrack.isValid()) {
             addCover(newTrack);
+            addFileInDirectory(newTrack.resourceURI(), newFiles[batchStart + i].second, true);
+
+            batchTracks.push_back(newTrack);
+        }
 
-            addFileInDirectory(newTrack.resourceURI(), path);
-            newFiles.push_back(newTrack);
+        if (!batchTracks.isEmpty()) {
+            emitNewFiles(batchTracks);
         }
     }
 }
@@ -184,24 +359,40 @@ const QString &AbstractFileListing::sourceName() const
     return d->mSourceName;
 }
 
-void AbstractFileListing::directoryChanged(const QString &path)
+void AbstractFileListing::directoriesChanged(const QStringList &paths)
 {
-    const auto directoryEntry = d->mDiscoveredFiles.find(QUrl::fromLocalFile(path));
-    if (directoryEntry == d->mDiscoveredFiles.end()) {
-        return;
+    auto newFiles = QVector<QPair<QUrl, QUrl>>();
+
+    for (const auto &onePath : paths) {
+        const auto directoryUrl = QUrl::fromLocalFile(onePath);
+
+        const auto directoryEntry = d->mDiscoveredFiles.find(directoryUrl);
+        if (directoryEntry == d->mDiscoveredFiles.end()) {
+            continue;
+        }
+
+        scanDirectory(newFiles, directoryUrl);
     }
 
-    scanDirectoryTree(path);
+    if (!newFiles.isEmpty()) {
+        extractNewFiles(newFiles);
+    }
 }
 
-void AbstractFileListing::fileChanged(const QString &modifiedFileName)
+void AbstractFileListing::filesModified(const QStringList &modifiedFileNames)
 {
-    auto modifiedFile = QUrl::fromLocalFile(modifiedFileName);
+    auto modifiedTracks = QList<MusicAudioTrack>();
 
-    auto modifiedTrack = scanOneFile(modifiedFile);
+    for (const auto &oneFileName : modifiedFileNames) {
+        auto modifiedTrack = scanOneFile(QUrl::fromLocalFile(oneFileName));
 
-    if (modifiedTrack.isValid()) {
-        Q_EMIT modifyTracksList({modifiedTrack}, d->mAllAlbumCover);
+        if (modifiedTrack.isValid()) {
+            modifiedTracks.push_back(modifiedTrack);
+        }
+    }
+
+    if (!modifiedTracks.isEmpty()) {
+        Q_EMIT modifyTracksList(modifiedTracks, d->mAllAlbumCover);
     }
 }
 
@@ -220,89 +411,24 @@ void AbstractFileListing::refreshContent()
 
 MusicAudioTrack AbstractFileListing::scanOneFile(const QUrl &scanFile)
 {
-    MusicAudioTrack newTrack;
-
-    QMimeDatabase mimeDb;
-    QString mimetype = mimeDb.mimeTypeForFile(scanFile.toLocalFile()).name();
-
-    QList<KFileMetaData::Extractor*> exList = d->mExtractors.fetchExtractors(mimetype);
-
-    if (exList.isEmpty()) {
-        return newTrack;
-    }
-
-    QFileInfo scanFileInfo(scanFile.toLocalFile());
-    if (scanFileInfo.exists()) {
-        watchPath(scanFile.toLocalFile());
-    }
-
-    KFileMetaData::Extractor* ex = exList.first();
-    KFileMetaData::SimpleExtractionResult result(scanFile.toLocalFile(), mimetype,
-                                                 KFileMetaData::ExtractionResult::ExtractMetaData);
-
-    ex->extract(&result);
-
-    const auto &allProperties = result.properties();
-
-    auto titleProperty = allProperties.find(KFileMetaData::Property::Title);
-    auto durationProperty = allProperties.find(KFileMetaData::Property::Duration);
-    auto artistProperty = allProperties.find(KFileMetaData::Property::Artist);
-    auto albumProperty = allProperties.find(KFileMetaData::Property::Album);
-    auto albumArtistProperty = allProperties.find(KFileMetaData::Property::AlbumArtist);
-    auto trackNumberProperty = allProperties.find(KFileMetaData::Property::TrackNumber);
-    auto fileData = KFileMetaData::UserMetaData(scanFile.toLocalFile());
-
-    if (albumProperty != allProperties.end()) {
-        auto albumValue = albumProperty->toString();
-
-        newTrack.setAlbumName(albumValue);
-
-        if (artistProperty != allProperties.end()) {
-            newTrack.setArtist(artistProperty->toString());
-        }
-
-        if (durationProperty != allProperties.end()) {
-            newTrack.setDuration(QTime::fromMSecsSinceStartOfDay(1000 * durationProperty->toDouble()));
-        }
-
-        if (titleProperty != allProperties.end()) {
-            newTrack.setTitle(titleProperty->toString());
-        }
-
-        if (trackNumberProperty != allProperties.end()) {
-            newTrack.setTrackNumber(trackNumberProperty->toInt());
-        }
-
-        if (albumArtistProperty != allProperties.end()) {
-            newTrack.setAlbumArtist(albumArtistProperty->toString());
-        }
-
-        if (newTrack.albumArtist().isEmpty()) {
-            newTrack.setAlbumArtist(newTrack.artist());
-        }
-
-        if (newTrack.artist().isEmpty()) {
-            newTrack.setArtist(newTrack.albumArtist());
-        }
-
-        newTrack.setResourceURI(scanFile);
-
-        newTrack.setRating(fileData.rating());
-
-        newTrack.setValid(true);
-    }
-
-    return newTrack;
+    return extractOneFile(scanFile, d->mExtractors);
 }
 
 void AbstractFileListing::watchPath(const QString &pathName)
 {
-    d->mFileSystemWatcher.addPath(pathName);
+    d->mDirectoryMonitor.addDirectory(pathName);
 }
 
 void AbstractFileListing::addFileInDirectory(const QUrl &newFile, const QUrl &directoryName)
 {
-    const auto directoryEntry = d->mDiscoveredFiles.find(directoryName);
+    QFileInfo isAFile(newFile.toLocalFile());
+
+    addFileInDirectory(newFile, directoryName, isAFile.isFile());
+}
+
+void AbstractFileListing::addFileInDirectory(const QUrl &newFile, const QUrl &directoryName, bool isFile)
+{
+    auto directoryEntry = d->mDiscoveredFiles.find(directoryName);
     if (directoryEntry == d->mDiscoveredFiles.end()) {
         watchPath(directoryName.toLocalFile());
 
@@ -315,25 +441,27 @@ void AbstractFileListing::addFileInDirectory(const QUrl &newFile, const QUrl &di
                 watchPath(parentDirectoryName);
             }
 
-            auto &parentCurrentDirectoryListingFiles = d->mDiscoveredFiles[parentDirectory];
-
-            parentCurrentDirectoryListingFiles.insert({directoryName, false});
+            d->mDiscoveredFiles[parentDirectory].insert(directoryName.toLocalFile(), false);
         }
+
+        directoryEntry = d->mDiscoveredFiles.insert(directoryName, {});
     }
-    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[directoryName];
 
-    QFileInfo isAFile(newFile.toLocalFile());
-    currentDirectoryListingFiles.insert({newFile, isAFile.isFile()});
+    directoryEntry->insert(newFile.toLocalFile(), isFile);
 }
 
 void AbstractFileListing::scanDirectoryTree(const QString &path)
 {
-    auto newFiles = QList<MusicAudioTrack>();
+    if (!QDir(path).exists()) {
+        d->mRestoredFiles.clear();
+    }
+
+    auto newFiles = QVector<QPair<QUrl, QUrl>>();
 
     scanDirectory(newFiles, QUrl::fromLocalFile(path));
 
     if (!newFiles.isEmpty()) {
-        emitNewFiles(newFiles);
+        extractNewFiles(newFiles);
     }
 }
 
@@ -370,17 +498,19 @@ void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QU
         return;
     }
 
-    const auto &currentRemovedDirectory = *itRemovedDirectory;
-    for (const auto &itFile : currentRemovedDirectory) {
-        if (itFile.first.isValid() && !itFile.first.isEmpty()) {
-            removeFile(itFile.first, allRemovedFiles);
-            if (itFile.second) {
-                allRemovedFiles.push_back(itFile.first);
-            }
-        }
-    }
+    const auto removedEntries = itRemovedDirectory->mEntries;
 
     d->mDiscoveredFiles.erase(itRemovedDirectory);
+
+    d->mDirectoryMonitor.removeDirectory(removedDirectory.toLocalFile());
+
+    for (const auto &oneEntry : removedEntries) {
+        if (oneEntry.second) {
+            allRemovedFiles.push_back(QUrl::fromLocalFile(oneEntry.first));
+        } else {
+            removeFile(QUrl::fromLocalFile(oneEntry.first), allRemovedFiles);
+        }
+    }
 }
 
 void AbstractFileListing::removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &allRemovedFiles)
@@ -391,5 +521,82 @@ void AbstractFileListing::removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &a
     }
 }
 
+static MusicAudioTrack extractOneFile(const QUrl &scanFile, KFileMetaData::ExtractorCollection &extractors)
+{
+    MusicAudioTrack newTrack;
+
+    QMimeDatabase mimeDb;
+    QString mimetype = mimeDb.mimeTypeForFile(scanFile.toLocalFile()).name();
+
+    QList<KFileMetaData::Extractor*> exList = extractors.fetchExtractors(mimetype);
+
+    if (exList.isEmpty()) {
+        return newTrack;
+    }
+
+    QFileInfo scanFileInfo(scanFile.toLocalFile());
+
+    newTrack.setFileSize(scanFileInfo.size());
+    newTrack.setFileModifiedTime(scanFileInfo.lastModified());
+
+    KFileMetaData::Extractor* ex = exList.first();
+    KFileMetaData::SimpleExtractionResult result(scanFile.toLocalFile(), mimetype,
+                                                 KFileMetaData::ExtractionResult::ExtractMetaData);
+
+    ex->extract(&result);
+
+    const auto &allProperties = result.properties();
+
+    auto titleProperty = allProperties.find(KFileMetaData::Property::Title);
+    auto durationProperty = allProperties.find(KFileMetaData::Property::Duration);
+    auto artistProperty = allProperties.find(KFileMetaData::Property::Artist);
+    auto albumProperty = allProperties.find(KFileMetaData::Property::Album);
+    auto albumArtistProperty = allProperties.find(KFileMetaData::Property::AlbumArtist);
+    auto trackNumberProperty = allProperties.find(KFileMetaData::Property::TrackNumber);
+    auto fileData = KFileMetaData::UserMetaData(scanFile.toLocalFile());
+
+    if (albumProperty != allProperties.end()) {
+        auto albumValue = albumProperty->toString();
+
+        newTrack.setAlbumName(albumValue);
+
+        if (artistProperty != allProperties.end()) {
+            newTrack.setArtist(artistProperty->toString());
+        }
+
+        if (durationProperty != allProperties.end()) {
+            newTrack.setDuration(QTime::fromMSecsSinceStartOfDay(1000 * durationProperty->toDouble()));
+        }
+
+        if (titleProperty != allProperties.end()) {
+            newTrack.setTitle(titleProperty->toString());
+        }
+
+        if (trackNumberProperty != allProperties.end()) {
+            newTrack.setTrackNumber(trackNumberProperty->toInt());
+        }
+
+        if (albumArtistProperty != allProperties.end()) {
+            newTrack.setAlbumArtist(albumArtistProperty->toString());
+        }
+
+        if (newTrack.albumArtist().isEmpty()) {
+            newTrack.setAlbumArtist(newTrack.artist());
+        }
+
+        if (newTrack.artist().isEmpty()) {
+            newTrack.setArtist(newTrack.albumArtist());
+        }
+
+        newTrack.setResourceURI(scanFile);
+
+        newTrack.setRating(fileData.rating());
+
+        newTrack.setValid(true);
+    }
+
+    return newTrack;
+}
+
 
 #include "moc_abstractfilelisting.cpp"
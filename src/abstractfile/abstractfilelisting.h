@@ -25,6 +25,9 @@
 #include <QUrl>
 #include <QHash>
 #include <QVector>
+#include <QPair>
+#include <QDateTime>
+#include <QStringList>
 
 #include <memory>
 
@@ -44,6 +47,10 @@ public:
 
     virtual void applicationAboutToQuit();
 
+    int extractionThreadCount() const;
+
+    void setExtractionThreadCount(int value);
+
 Q_SIGNALS:
 
     void tracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
@@ -52,6 +59,8 @@ Q_SIGNALS:
 
     void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers);
 
+    void askRestoredTracks(const QString &musicSource);
+
 public Q_SLOTS:
 
     void refreshContent();
@@ -62,11 +71,13 @@ public Q_SLOTS:
 
     void newTrackFile(const MusicAudioTrack &partialTrack);
 
+    void restoredTracks(const QString &musicSource, const QHash<QUrl, QPair<qint64, QDateTime>> &allFiles);
+
 protected Q_SLOTS:
 
-    void directoryChanged(const QString &path);
+    void directoriesChanged(const QStringList &paths);
 
-    void fileChanged(const QString &modifiedFileName);
+    void filesModified(const QStringList &modifiedFileNames);
 
 protected:
 
@@ -74,7 +85,9 @@ protected:
 
     virtual void triggerRefreshOfContent();
 
-    void scanDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path);
+    void scanDirectory(QVector<QPair<QUrl, QUrl>> &newFiles, const QUrl &path);
+
+    void extractNewFiles(const QVector<QPair<QUrl, QUrl>> &newFiles);
 
     const QString &sourceName() const;
 
@@ -84,6 +97,8 @@ protected:
 
     void addFileInDirectory(const QUrl &newFile, const QUrl &directoryName);
 
+    void addFileInDirectory(const QUrl &newFile, const QUrl &directoryName, bool isFile);
+
     void scanDirectoryTree(const QString &path);
 
     void setHandleNewFiles(bool handleThem);
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "directorymonitor.h"
+
+#include "config-upnp-qt.h"
+
+#include <QFileSystemWatcher>
+#include <QFile>
+#include <QSocketNotifier>
+#include <QTimer>
+#include <QHash>
+#include <QSet>
+
+#include <QDebug>
+
+#include <algorithm>
+
+#if HAVE_INOTIFY
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#endif
+
+class DirectoryMonitorPrivate
+{
+public:
+
+    explicit DirectoryMonitorPrivate(QObject *owner) : mFallbackWatcher(owner), mPublishTimer(owner)
+    {
+    }
+
+    int mInotifyDescriptor = -1;
+
+    std::unique_ptr<QSocketNotifier> mInotifyNotifier;
+
+    QHash<int, QString> mDirectoryFromWatch;
+
+    QHash<QString, int> mWatchFromDirectory;
+
+    QFileSystemWatcher mFallbackWatcher;
+
+    QSet<QString> mChangedDirectories;
+
+    QSet<QString> mCreatedFiles;
+
+    QSet<QString> mModifiedFiles;
+
+    QTimer mPublishTimer;
+
+};
+
+DirectoryMonitor::DirectoryMonitor(QObject *parent) : QObject(parent), d(new DirectoryMonitorPrivate(this))
+{
+    d->mPublishTimer.setSingleShot(true);
+    d->mPublishTimer.setInterval(300);
+
+    connect(&d->mPublishTimer, &QTimer::timeout,
+            this, &DirectoryMonitor::publishChanges);
+
+#if HAVE_INOTIFY
+    d->mInotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (d->mInotifyDescriptor != -1) {
+        d->mInotifyNotifier.reset(new QSocketNotifier(d->mInotifyDescriptor, QSocketNotifier::Read, this));
+
+        connect(d->mInotifyNotifier.get(), &QSocketNotifier::activated,
+                this, &DirectoryMonitor::readEvents);
+    } else {
+        qDebug() << "DirectoryMonitor::DirectoryMonitor" << "inotify is not available" << errno;
+    }
+#endif
+
+    connect(&d->mFallbackWatcher, &QFileSystemWatcher::directoryChanged,
+            this, &DirectoryMonitor::directoryChanged);
+}
+
+DirectoryMonitor::~DirectoryMonitor()
+{
+#if HAVE_INOTIFY
+    d->mInotifyNotifier.reset();
+
+    if (d->mInotifyDescriptor != -1) {
+        close(d->mInotifyDescriptor);
+    }
+#endif
+}
+
+bool DirectoryMonitor::addDirectory(const QString &path)
+{
+    if (d->mWatchFromDirectory.contains(path)) {
+        return true;
+    }
+
+#if HAVE_INOTIFY
+    if (d->mInotifyDescriptor != -1) {
+        const auto watchDescriptor = inotify_add_watch(d->mInotifyDescriptor, QFile::encodeName(path).constData(),
+                                                       IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                                       IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+
+        if (watchDescriptor == -1) {
+            qDebug() << "DirectoryMonitor::addDirectory" << path << "cannot be watched" << errno;
+            return false;
+        }
+
+        d->mDirectoryFromWatch[watchDescriptor] = path;
+        d->mWatchFromDirectory[path] = watchDescriptor;
+
+        return true;
+    }
+#endif
+
+    if (!d->mFallbackWatcher.addPath(path)) {
+        return false;
+    }
+
+    d->mWatchFromDirectory[path] = -1;
+
+    return true;
+}
+
+void DirectoryMonitor::removeDirectory(const QString &path)
+{
+    auto itWatch = d->mWatchFromDirectory.find(path);
+    if (itWatch == d->mWatchFromDirectory.end()) {
+        return;
+    }
+
+#if HAVE_INOTIFY
+    if (d->mInotifyDescriptor != -1) {
+        inotify_rm_watch(d->mInotifyDescriptor, itWatch.value());
+        d->mDirectoryFromWatch.remove(itWatch.value());
+    }
+#endif
+
+    if (itWatch.value() == -1) {
+        d->mFallbackWatcher.removePath(path);
+    }
+
+    d->mWatchFromDirectory.erase(itWatch);
+}
+
+int DirectoryMonitor::directoriesCount() const
+{
+    return d->mWatchFromDirectory.size();
+}
+
+int DirectoryMonitor::coalescingDelay() const
+{
+    return d->mPublishTimer.interval();
+}
+
+void DirectoryMonitor::setCoalescingDelay(int value)
+{
+    d->mPublishTimer.setInterval(value);
+}
+
+void DirectoryMonitor::readEvents()
+{
+#if HAVE_INOTIFY
+    alignas(struct inotify_event) char buffer[16384];
+
+    while (true) {
+        const auto readBytes = read(d->mInotifyDescriptor, buffer, sizeof(buffer));
+
+        if (readBytes <= 0) {
+            break;
+        }
+
+        for (auto current = buffer; current < buffer + readBytes; ) {
+            const auto event = reinterpret_cast<const struct inotify_event*>(current);
+            current += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                for (const auto &oneDirectory : d->mDirectoryFromWatch) {
+                    d->mChangedDirectories.insert(oneDirectory);
+                }
+                continue;
+            }
+
+            const auto itDirectory = d->mDirectoryFromWatch.find(event->wd);
+            if (itDirectory == d->mDirectoryFromWatch.end()) {
+                continue;
+            }
+
+            const auto directory = itDirectory.value();
+
+            if (event->mask & IN_IGNORED) {
+                d->mWatchFromDirectory.remove(directory);
+                d->mDirectoryFromWatch.erase(itDirectory);
+                continue;
+            }
+
+            const auto fileName = (event->len ? directory + QLatin1Char('/') + QFile::decodeName(event->name) : QString());
+
+            if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                d->mChangedDirectories.insert(directory);
+                d->mCreatedFiles.insert(fileName);
+                d->mModifiedFiles.remove(fileName);
+            } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                d->mChangedDirectories.insert(directory);
+                d->mModifiedFiles.remove(fileName);
+            } else if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                d->mChangedDirectories.insert(directory);
+            } else if ((event->mask & IN_CLOSE_WRITE) && !fileName.isEmpty() && !d->mCreatedFiles.contains(fileName)) {
+                d->mModifiedFiles.insert(fileName);
+            }
+        }
+    }
+
+    if (!d->mPublishTimer.isActive() && (!d->mChangedDirectories.isEmpty() || !d->mModifiedFiles.isEmpty())) {
+        d->mPublishTimer.start();
+    }
+#endif
+}
+
+void DirectoryMonitor::directoryChanged(const QString &path)
+{
+    d->mChangedDirectories.insert(path);
+
+    if (!d->mPublishTimer.isActive()) {
+        d->mPublishTimer.start();
+    }
+}
+
+void DirectoryMonitor::publishChanges()
+{
+    auto changedDirectories = d->mChangedDirectories.toList();
+    auto modifiedFiles = d->mModifiedFiles.toList();
+
+    d->mChangedDirectories.clear();
+    d->mCreatedFiles.clear();
+    d->mModifiedFiles.clear();
+
+    if (!changedDirectories.isEmpty()) {
+        std::sort(changedDirectories.begin(), changedDirectories.end());
+
+        Q_EMIT directoriesChanged(changedDirectories);
+    }
+
+    if (!modifiedFiles.isEmpty()) {
+        std::sort(modifiedFiles.begin(), modifiedFiles.end());
+
+        Q_EMIT filesModified(modifiedFiles);
+    }
+}
+
+
+#include "moc_directorymonitor.cpp"
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DIRECTORYMONITOR_H
+#define DIRECTORYMONITOR_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+#include <memory>
+
+class DirectoryMonitorPrivate;
+
+class DirectoryMonitor : public QObject
+{
+
+    Q_OBJECT
+
+public:
+
+    explicit DirectoryMonitor(QObject *parent = 0);
+
+    virtual ~DirectoryMonitor();
+
+    bool addDirectory(const QString &path);
+
+    void removeDirectory(const QString &path);
+
+    int directoriesCount() const;
+
+    int coalescingDelay() const;
+
+    void setCoalescingDelay(int value);
+
+Q_SIGNALS:
+
+    void directoriesChanged(const QStringList &directories);
+
+    void filesModified(const QStringList &files);
+
+private Q_SLOTS:
+
+    void readEvents();
+
+    void directoryChanged(const QString &path);
+
+    void publishChanges();
+
+private:
+
+    std::unique_ptr<DirectoryMonitorPrivate> d;
+
+};
+
+#endif // DIRECTORYMONITOR_H
@@ -76,16 +76,24 @@ bool AlbumFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex &
     for (int column = 0, columnCount = sourceModel()->columnCount(source_parent); column < columnCount; ++column) {
         auto currentIndex = sourceModel()->index(source_row, column, source_parent);
 
-        const auto &titleValue = sourceModel()->data(currentIndex, AllAlbumsModel::TitleRole).toString();
-        const auto &artistValue = sourceModel()->data(currentIndex, AllAlbumsModel::ArtistRole).toString();
-        const auto &allArtistsValue = sourceModel()->data(currentIndex, AllAlbumsModel::AllArtistsRole).toStringList();
-        const auto maximumRatingValue = sourceModel()->data(currentIndex, AllAlbumsModel::HighestTrackRating).toInt();
+        if (mFilterRating > 0) {
+            const auto maximumRatingValue = sourceModel()->data(currentIndex, AllAlbumsModel::HighestTrackRating).toInt();
+
+            if (maximumRatingValue < mFilterRating) {
+                result = false;
+                continue;
+            }
+        }
 
-        if (maximumRatingValue < mFilterRating) {
-            result = false;
+        if (mFilterText.isEmpty()) {
+            result = true;
             continue;
         }
 
+        const auto &titleValue = sourceModel()->data(currentIndex, AllAlbumsModel::TitleRole).toString();
+        const auto &artistValue = sourceModel()->data(currentIndex, AllAlbumsModel::ArtistRole).toString();
+        const auto &allArtistsValue = sourceModel()->data(currentIndex, AllAlbumsModel::AllArtistsRole).toStringList();
+
         if (mFilterExpression.match(titleValue).hasMatch()) {
             result = true;
             continue;
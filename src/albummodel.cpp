@@ -25,6 +25,10 @@
 #include <QTimer>
 #include <QPointer>
 #include <QVector>
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
 
 class AlbumModelPrivate
 {
@@ -40,8 +44,41 @@ public:
 
     MusicAlbum mCurrentAlbum;
 
+    QPointer<DatabaseInterface> mDatabase;
+
+    qulonglong mPendingAlbumId = 0;
+
 };
 
+static QVector<bool> longestIncreasingRows(const QVector<int> &values)
+{
+    auto result = QVector<bool>(values.size(), false);
+    auto tailRows = QVector<int>();
+    auto previousRows = QVector<int>(values.size(), -1);
+
+    for (int row = 0; row < values.size(); ++row) {
+        auto tailIterator = std::lower_bound(tailRows.begin(), tailRows.end(), values[row],
+                                             [&values](int tailRow, int value) {return values[tailRow] < value;});
+        const auto sequenceLength = tailIterator - tailRows.begin();
+
+        if (sequenceLength > 0) {
+            previousRows[row] = tailRows[sequenceLength - 1];
+        }
+
+        if (tailIterator == tailRows.end()) {
+            tailRows.push_back(row);
+        } else {
+            *tailIterator = row;
+        }
+    }
+
+    for (auto row = (tailRows.isEmpty() ? -1 : tailRows.last()); row != -1; row = previousRows[row]) {
+        result[row] = true;
+    }
+
+    return result;
+}
+
 AlbumModel::AlbumModel(QObject *parent) : QAbstractItemModel(parent), d(new AlbumModelPrivate)
 {
 }
@@ -250,6 +287,11 @@ QString AlbumModel::author() const
     return d->mAuthor;
 }
 
+DatabaseInterface *AlbumModel::database() const
+{
+    return d->mDatabase;
+}
+
 void AlbumModel::setAlbumData(const MusicAlbum &album)
 {
     if (d->mCurrentAlbum == album) {
@@ -262,6 +304,24 @@ void AlbumModel::setAlbumData(const MusicAlbum &album)
         endRemoveRows();
     }
 
+    if (!album.isTracksLoaded()) {
+        // no rows until albumTracks arrives, but keep the summary the
+        // database already computed for this album
+        d->mCurrentAlbum = album;
+        d->mCurrentAlbum.setTracks({});
+        d->mCurrentAlbum.setAllArtists(album.allArtists());
+        d->mCurrentAlbum.setAllTracksTitle(album.allTracksTitle());
+        d->mCurrentAlbum.setHighestTrackRating(album.highestTrackRating());
+        d->mPendingAlbumId = album.databaseId();
+
+        Q_EMIT albumDataChanged();
+        Q_EMIT fetchAlbumTracks(d->mPendingAlbumId);
+
+        return;
+    }
+
+    d->mPendingAlbumId = 0;
+
     beginInsertRows({}, 0, album.tracksCount() - 1);
     d->mCurrentAlbum = album;
     endInsertRows();
@@ -269,6 +329,23 @@ void AlbumModel::setAlbumData(const MusicAlbum &album)
     Q_EMIT albumDataChanged();
 }
 
+void AlbumModel::albumTracks(qulonglong albumId, const QList<MusicAudioTrack> &tracks)
+{
+    if (albumId == 0 || albumId != d->mPendingAlbumId) {
+        return;
+    }
+
+    d->mPendingAlbumId = 0;
+
+    if (tracks.isEmpty()) {
+        return;
+    }
+
+    beginInsertRows({}, 0, tracks.size() - 1);
+    d->mCurrentAlbum.setTracks(tracks);
+    endInsertRows();
+}
+
 void AlbumModel::setTitle(const QString &title)
 {
     if (d->mTitle == title)
@@ -287,110 +364,234 @@ void AlbumModel::setAuthor(const QString &author)
     emit authorChanged();
 }
 
-void AlbumModel::albumModified(const MusicAlbum &modifiedAlbum)
+void AlbumModel::setDatabase(DatabaseInterface *database)
 {
-    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
+    if (d->mDatabase == database) {
         return;
     }
 
-    auto removedTracks = QList<MusicAudioTrack>();
+    if (d->mDatabase) {
+        disconnect(d->mDatabase, 0, this, 0);
+        disconnect(this, 0, d->mDatabase, 0);
+    }
 
-    for (auto i = 0; i < d->mCurrentAlbum.tracksCount(); ++i) {
-        bool trackExist = false;
+    d->mDatabase = database;
 
-        for (auto j = 0; j < modifiedAlbum.tracksCount() && !trackExist; ++j) {
-            trackExist = (d->mCurrentAlbum.trackIdFromIndex(i) == modifiedAlbum.trackIdFromIndex(j));
-            if (trackExist) {
-                const auto &oldTrack = d->mCurrentAlbum.trackFromIndex(i);
-                const auto &newTrack = modifiedAlbum.trackFromIndex(j);
+    if (d->mDatabase) {
+        connect(this, &AlbumModel::fetchAlbumTracks,
+                d->mDatabase, &DatabaseInterface::fetchAlbumTracks);
+        connect(d->mDatabase, &DatabaseInterface::albumTracks,
+                this, &AlbumModel::albumTracks);
 
-                if (oldTrack != newTrack) {
-                    trackModified(newTrack);
-                }
-            }
+        if (d->mPendingAlbumId != 0) {
+            Q_EMIT fetchAlbumTracks(d->mPendingAlbumId);
         }
+    }
 
-        if (!trackExist) {
-            const auto &oldTrack = d->mCurrentAlbum.trackFromIndex(i);
-            removedTracks.push_back(oldTrack);
-        }
+    Q_EMIT databaseChanged();
+}
+
+void AlbumModel::albumModified(const MusicAlbum &modifiedAlbum)
+{
+    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
+        return;
     }
 
-    for (const auto &removedTrack : removedTracks) {
-        trackRemoved(removedTrack);
+    if (!modifiedAlbum.isTracksLoaded()) {
+        return;
     }
 
-    for (auto j = 0; j < modifiedAlbum.tracksCount(); ++j) {
-        bool trackExist = false;
+    d->mPendingAlbumId = 0;
+
+    auto currentTracks = QList<MusicAudioTrack>();
+    currentTracks.reserve(d->mCurrentAlbum.tracksCount());
+    for (int trackIndex = 0; trackIndex < d->mCurrentAlbum.tracksCount(); ++trackIndex) {
+        currentTracks.push_back(d->mCurrentAlbum.trackFromIndex(trackIndex));
+    }
 
-        for (auto i = 0; i < d->mCurrentAlbum.tracksCount() && !trackExist; ++i) {
-            trackExist = (d->mCurrentAlbum.trackIdFromIndex(i) == modifiedAlbum.trackIdFromIndex(j));
+    auto newTracks = QList<MusicAudioTrack>();
+    newTracks.reserve(modifiedAlbum.tracksCount());
+    for (int trackIndex = 0; trackIndex < modifiedAlbum.tracksCount(); ++trackIndex) {
+        newTracks.push_back(modifiedAlbum.trackFromIndex(trackIndex));
+    }
+
+    auto newTracksIndex = QHash<qulonglong, int>();
+    newTracksIndex.reserve(newTracks.size());
+    for (int trackIndex = 0; trackIndex < newTracks.size(); ++trackIndex) {
+        newTracksIndex[newTracks[trackIndex].databaseId()] = trackIndex;
+    }
+
+    auto removedRows = QVector<int>();
+    auto currentTracksId = QSet<qulonglong>();
+    currentTracksId.reserve(currentTracks.size());
+    for (int trackIndex = 0; trackIndex < currentTracks.size(); ++trackIndex) {
+        if (newTracksIndex.contains(currentTracks[trackIndex].databaseId())) {
+            currentTracksId.insert(currentTracks[trackIndex].databaseId());
+        } else {
+            removedRows.push_back(trackIndex);
         }
+    }
 
-        if (!trackExist) {
-            const auto &newTrack = modifiedAlbum.trackFromIndex(j);
-            trackAdded(newTrack);
+    auto lastRemovedRow = removedRows.size() - 1;
+    while (lastRemovedRow >= 0) {
+        auto firstRemovedRow = lastRemovedRow;
+        while (firstRemovedRow > 0 && removedRows[firstRemovedRow - 1] == removedRows[firstRemovedRow] - 1) {
+            --firstRemovedRow;
         }
+
+        const auto firstRow = removedRows[firstRemovedRow];
+        const auto removedCount = lastRemovedRow - firstRemovedRow + 1;
+
+        beginRemoveRows({}, firstRow, firstRow + removedCount - 1);
+        currentTracks.erase(currentTracks.begin() + firstRow, currentTracks.begin() + firstRow + removedCount);
+        d->mCurrentAlbum.setTracks(currentTracks);
+        endRemoveRows();
+
+        lastRemovedRow = firstRemovedRow - 1;
     }
-}
 
-void AlbumModel::albumRemoved(const MusicAlbum &modifiedAlbum)
-{
-    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
-        return;
+    auto keptTracksRank = QHash<qulonglong, int>();
+    keptTracksRank.reserve(currentTracks.size());
+    auto keptTrackRank = 0;
+    for (const auto &oneTrack : newTracks) {
+        if (currentTracksId.contains(oneTrack.databaseId())) {
+            keptTracksRank[oneTrack.databaseId()] = keptTrackRank;
+            ++keptTrackRank;
+        }
     }
 
-    for (int trackIndex = d->mCurrentAlbum.tracksCount() - 1; trackIndex >= 0 ; --trackIndex) {
-        trackRemoved(d->mCurrentAlbum.trackFromIndex(trackIndex));
+    auto currentRanks = QVector<int>();
+    currentRanks.reserve(currentTracks.size());
+    for (const auto &oneTrack : currentTracks) {
+        currentRanks.push_back(keptTracksRank.value(oneTrack.databaseId()));
     }
-}
 
-void AlbumModel::trackAdded(const MusicAudioTrack &newTrack)
-{
-    if (newTrack.albumName() != d->mCurrentAlbum.title()) {
-        return;
+    const auto inPlaceRows = longestIncreasingRows(currentRanks);
+
+    auto movedRanks = QVector<int>();
+    for (int trackIndex = 0; trackIndex < currentRanks.size(); ++trackIndex) {
+        if (!inPlaceRows[trackIndex]) {
+            movedRanks.push_back(currentRanks[trackIndex]);
+        }
     }
 
-    auto trackIndex = d->mCurrentAlbum.trackIndexFromId(newTrack.databaseId());
+    std::sort(movedRanks.begin(), movedRanks.end());
 
-    if (trackIndex != -1) {
-        return;
+    auto movedIndex = 0;
+    while (movedIndex < movedRanks.size()) {
+        const auto firstRank = movedRanks[movedIndex];
+        const auto sourceRow = currentRanks.indexOf(firstRank);
+
+        auto movedCount = 1;
+        while (movedIndex + movedCount < movedRanks.size() &&
+               movedRanks[movedIndex + movedCount] == firstRank + movedCount &&
+               sourceRow + movedCount < currentRanks.size() &&
+               currentRanks[sourceRow + movedCount] == firstRank + movedCount) {
+            ++movedCount;
+        }
+
+        const auto destinationRow = (firstRank == 0 ? 0 : currentRanks.indexOf(firstRank - 1) + 1);
+
+        if (destinationRow < sourceRow || destinationRow > sourceRow + movedCount) {
+            beginMoveRows({}, sourceRow, sourceRow + movedCount - 1, {}, destinationRow);
+
+            const auto movedTracks = currentTracks.mid(sourceRow, movedCount);
+            const auto movedTracksRank = currentRanks.mid(sourceRow, movedCount);
+
+            currentTracks.erase(currentTracks.begin() + sourceRow, currentTracks.begin() + sourceRow + movedCount);
+            currentRanks.remove(sourceRow, movedCount);
+
+            const auto insertionRow = (destinationRow > sourceRow ? destinationRow - movedCount : destinationRow);
+            for (int trackIndex = 0; trackIndex < movedCount; ++trackIndex) {
+                currentTracks.insert(insertionRow + trackIndex, movedTracks[trackIndex]);
+                currentRanks.insert(insertionRow + trackIndex, movedTracksRank[trackIndex]);
+            }
+
+            d->mCurrentAlbum.setTracks(currentTracks);
+            endMoveRows();
+        }
+
+        movedIndex += movedCount;
     }
 
-    bool trackInserted = false;
-    for (int trackIndex = 0; trackIndex < d->mCurrentAlbum.tracksCount(); ++trackIndex) {
-        const auto &oneTrack = d->mCurrentAlbum.trackFromIndex(trackIndex);
-
-        if (oneTrack.discNumber() == newTrack.discNumber() && oneTrack.trackNumber() > newTrack.trackNumber()) {
-            beginInsertRows({}, trackIndex, trackIndex);
-            d->mCurrentAlbum.insertTrack(newTrack, trackIndex);
-            endInsertRows();
-            trackInserted = true;
-            break;
+    auto modifiedRows = QVector<int>();
+    for (int trackIndex = 0; trackIndex < currentTracks.size(); ++trackIndex) {
+        const auto &newTrack = newTracks[newTracksIndex.value(currentTracks[trackIndex].databaseId())];
+
+        if (currentTracks[trackIndex] != newTrack) {
+            currentTracks[trackIndex] = newTrack;
+            modifiedRows.push_back(trackIndex);
         }
     }
 
-    if (!trackInserted) {
-        beginInsertRows({}, d->mCurrentAlbum.tracksCount(), d->mCurrentAlbum.tracksCount());
-        d->mCurrentAlbum.insertTrack(newTrack, d->mCurrentAlbum.tracksCount());
+    if (!modifiedRows.isEmpty()) {
+        d->mCurrentAlbum.setTracks(currentTracks);
+
+        auto firstModifiedRow = 0;
+        while (firstModifiedRow < modifiedRows.size()) {
+            auto lastModifiedRow = firstModifiedRow;
+            while (lastModifiedRow + 1 < modifiedRows.size() && modifiedRows[lastModifiedRow + 1] == modifiedRows[lastModifiedRow] + 1) {
+                ++lastModifiedRow;
+            }
+
+            Q_EMIT dataChanged(index(modifiedRows[firstModifiedRow], 0), index(modifiedRows[lastModifiedRow], 0));
+
+            firstModifiedRow = lastModifiedRow + 1;
+        }
+    }
+
+    auto newTrackIndex = 0;
+    while (newTrackIndex < newTracks.size()) {
+        if (currentTracksId.contains(newTracks[newTrackIndex].databaseId())) {
+            ++newTrackIndex;
+            continue;
+        }
+
+        auto lastNewTrackIndex = newTrackIndex;
+        while (lastNewTrackIndex + 1 < newTracks.size() && !currentTracksId.contains(newTracks[lastNewTrackIndex + 1].databaseId())) {
+            ++lastNewTrackIndex;
+        }
+
+        beginInsertRows({}, newTrackIndex, lastNewTrackIndex);
+        for (int trackIndex = newTrackIndex; trackIndex <= lastNewTrackIndex; ++trackIndex) {
+            currentTracks.insert(trackIndex, newTracks[trackIndex]);
+        }
+        d->mCurrentAlbum.setTracks(currentTracks);
         endInsertRows();
+
+        newTrackIndex = lastNewTrackIndex + 1;
     }
 }
 
-void AlbumModel::trackModified(const MusicAudioTrack &modifiedTrack)
+void AlbumModel::albumsModified(const QList<MusicAlbum> &modifiedAlbums)
 {
-    if (modifiedTrack.albumName() != d->mCurrentAlbum.title()) {
-        return;
+    for (const auto &oneAlbum : modifiedAlbums) {
+        if (oneAlbum.databaseId() == d->mCurrentAlbum.databaseId()) {
+            albumModified(oneAlbum);
+            return;
+        }
     }
+}
 
-    auto trackIndex = d->mCurrentAlbum.trackIndexFromId(modifiedTrack.databaseId());
-
-    if (trackIndex == -1) {
+void AlbumModel::albumRemoved(const MusicAlbum &modifiedAlbum)
+{
+    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
         return;
     }
 
-    d->mCurrentAlbum.updateTrack(modifiedTrack, trackIndex);
-    Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
+    for (int trackIndex = d->mCurrentAlbum.tracksCount() - 1; trackIndex >= 0 ; --trackIndex) {
+        trackRemoved(d->mCurrentAlbum.trackFromIndex(trackIndex));
+    }
+}
+
+void AlbumModel::albumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    for (const auto &oneAlbum : removedAlbums) {
+        if (oneAlbum.databaseId() == d->mCurrentAlbum.databaseId()) {
+            albumRemoved(oneAlbum);
+            return;
+        }
+    }
 }
 
 void AlbumModel::trackRemoved(const MusicAudioTrack &removedTrack)
@@ -22,6 +22,7 @@
 
 #include <QAbstractItemModel>
 #include <QVector>
+#include <QList>
 #include <QHash>
 #include <QString>
 
@@ -52,6 +53,11 @@ class AlbumModel : public QAbstractItemModel
                WRITE setAuthor
                NOTIFY authorChanged)
 
+    Q_PROPERTY(DatabaseInterface* database
+               READ database
+               WRITE setDatabase
+               NOTIFY databaseChanged)
+
 public:
 
     enum ItemClass {
@@ -106,6 +112,8 @@ public:
 
     QString author() const;
 
+    DatabaseInterface* database() const;
+
 Q_SIGNALS:
 
     void albumDataChanged();
@@ -114,6 +122,10 @@ Q_SIGNALS:
 
     void authorChanged();
 
+    void databaseChanged();
+
+    void fetchAlbumTracks(qulonglong albumId);
+
 public Q_SLOTS:
 
     void setAlbumData(const MusicAlbum &album);
@@ -122,15 +134,19 @@ public Q_SLOTS:
 
     void setAuthor(const QString &author);
 
+    void setDatabase(DatabaseInterface *database);
+
+    void albumTracks(qulonglong albumId, const QList<MusicAudioTrack> &tracks);
+
     void albumModified(const MusicAlbum &modifiedAlbum);
 
-    void albumRemoved(const MusicAlbum &modifiedAlbum);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
-private:
+    void albumRemoved(const MusicAlbum &modifiedAlbum);
 
-    void trackAdded(const MusicAudioTrack &newTrack);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
-    void trackModified(const MusicAudioTrack &modifiedTrack);
+private:
 
     void trackRemoved(const MusicAudioTrack &removedTrack);
 
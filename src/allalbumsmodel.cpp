@@ -20,11 +20,13 @@
 #include "allalbumsmodel.h"
 #include "musicstatistics.h"
 #include "databaseinterface.h"
+#include "entitieswindows.h"
 
 #include <QUrl>
 #include <QTimer>
 #include <QPointer>
 #include <QVector>
+#include <QHash>
 
 #include <algorithm>
 
@@ -38,12 +40,33 @@ public:
 
     QVector<MusicAlbum> mAllAlbums;
 
-    int mAlbumCount = 0;
+    QHash<qulonglong, int> mAlbumsRow;
+
+    QPointer<DatabaseInterface> mDatabase;
+
+    EntitiesWindows<MusicAlbum> mAlbumsWindows;
+
+    QString mFilterText;
+
+    int mFilterRating = 0;
+
+    qulonglong mArtistId = 0;
+
+    QTimer mFetchTimer;
+
+    QTimer mRefreshTimer;
 
 };
 
 AllAlbumsModel::AllAlbumsModel(QObject *parent) : QAbstractItemModel(parent), d(new AllAlbumsModelPrivate)
 {
+    d->mFetchTimer.setSingleShot(true);
+    d->mFetchTimer.setInterval(0);
+    connect(&d->mFetchTimer, &QTimer::timeout, this, &AllAlbumsModel::requestWindows);
+
+    d->mRefreshTimer.setSingleShot(true);
+    d->mRefreshTimer.setInterval(100);
+    connect(&d->mRefreshTimer, &QTimer::timeout, this, &AllAlbumsModel::refreshWindows);
 }
 
 AllAlbumsModel::~AllAlbumsModel()
@@ -59,7 +82,11 @@ int AllAlbumsModel::rowCount(const QModelIndex &parent) const
         return albumCount;
     }
 
-    albumCount = d->mAlbumCount;
+    if (isWindowed()) {
+        albumCount = d->mAlbumsWindows.entitiesCount();
+    } else {
+        albumCount = d->mAllAlbums.size();
+    }
 
     return albumCount;
 }
@@ -77,6 +104,7 @@ QHash<int, QByteArray> AllAlbumsModel::roleNames() const
     roles[static_cast<int>(ColumnsRoles::IsSingleDiscAlbumRole)] = "isSingleDiscAlbum";
     roles[static_cast<int>(ColumnsRoles::AlbumDataRole)] = "albumData";
     roles[static_cast<int>(ColumnsRoles::HighestTrackRating)] = "highestTrackRating";
+    roles[static_cast<int>(ColumnsRoles::DatabaseIdRole)] = "databaseId";
 
     return roles;
 }
@@ -94,7 +122,7 @@ QVariant AllAlbumsModel::data(const QModelIndex &index, int role) const
 {
     auto result = QVariant();
 
-    const auto albumCount = d->mAlbumCount;
+    const auto albumCount = rowCount();
 
     if (!index.isValid()) {
         return result;
@@ -120,11 +148,17 @@ QVariant AllAlbumsModel::data(const QModelIndex &index, int role) const
         return result;
     }
 
-    result = internalDataAlbum(index.row(), role);
+    const auto album = albumFromRow(index.row());
+
+    if (!album) {
+        return result;
+    }
+
+    result = internalDataAlbum(*album, role);
     return result;
 }
 
-QVariant AllAlbumsModel::internalDataAlbum(int albumIndex, int role) const
+QVariant AllAlbumsModel::internalDataAlbum(const MusicAlbum &album, int role) const
 {
     auto result = QVariant();
 
@@ -133,39 +167,42 @@ QVariant AllAlbumsModel::internalDataAlbum(int albumIndex, int role) const
     switch(convertedRole)
     {
     case ColumnsRoles::TitleRole:
-        result = d->mAllAlbums[albumIndex].title();
+        result = album.title();
         break;
     case ColumnsRoles::AllTracksTitleRole:
-        result = d->mAllAlbums[albumIndex].allTracksTitle();
+        result = album.allTracksTitle();
         break;
     case ColumnsRoles::ArtistRole:
-        result = d->mAllAlbums[albumIndex].artist();
+        result = album.artist();
         break;
     case ColumnsRoles::AllArtistsRole:
-        result = d->mAllAlbums[albumIndex].allArtists().join(QStringLiteral(", "));
+        result = album.allArtistsText();
         break;
     case ColumnsRoles::ImageRole:
     {
-        auto albumArt = d->mAllAlbums[albumIndex].albumArtURI();
+        auto albumArt = album.albumArtURI();
         if (albumArt.isValid()) {
             result = albumArt;
         }
         break;
     }
     case ColumnsRoles::CountRole:
-        result = d->mAllAlbums[albumIndex].tracksCount();
+        result = album.tracksCount();
         break;
     case ColumnsRoles::IdRole:
-        result = d->mAllAlbums[albumIndex].id();
+        result = album.id();
         break;
     case ColumnsRoles::IsSingleDiscAlbumRole:
-        result = d->mAllAlbums[albumIndex].isSingleDiscAlbum();
+        result = album.isSingleDiscAlbum();
         break;
     case ColumnsRoles::AlbumDataRole:
-        result = QVariant::fromValue(d->mAllAlbums[albumIndex]);
+        result = QVariant::fromValue(album);
         break;
     case ColumnsRoles::HighestTrackRating:
-        result = d->mAllAlbums[albumIndex].highestTrackRating();
+        result = album.highestTrackRating();
+        break;
+    case ColumnsRoles::DatabaseIdRole:
+        result = album.databaseId();
         break;
     }
 
@@ -205,44 +242,434 @@ int AllAlbumsModel::columnCount(const QModelIndex &parent) const
     return 1;
 }
 
+DatabaseInterface *AllAlbumsModel::database() const
+{
+    return d->mDatabase;
+}
+
+QString AllAlbumsModel::filterText() const
+{
+    return d->mFilterText;
+}
+
+int AllAlbumsModel::filterRating() const
+{
+    return d->mFilterRating;
+}
+
+qulonglong AllAlbumsModel::artistId() const
+{
+    return d->mArtistId;
+}
+
 void AllAlbumsModel::albumAdded(const MusicAlbum &newAlbum)
 {
-    if (newAlbum.isValid()) {
-        beginInsertRows({}, d->mAllAlbums.size(), d->mAllAlbums.size());
-        d->mAllAlbums.push_back(newAlbum);
-        ++d->mAlbumCount;
-        endInsertRows();
+    albumsAdded({newAlbum});
+}
+
+void AllAlbumsModel::albumsAdded(const QList<MusicAlbum> &newAlbums)
+{
+    if (d->mDatabase) {
+        d->mRefreshTimer.start();
+        return;
     }
+
+    auto validAlbums = QVector<MusicAlbum>();
+    validAlbums.reserve(newAlbums.size());
+
+    for (const auto &oneAlbum : newAlbums) {
+        if (oneAlbum.isValid()) {
+            validAlbums.push_back(oneAlbum);
+        }
+    }
+
+    if (validAlbums.isEmpty()) {
+        return;
+    }
+
+    const auto firstNewRow = d->mAllAlbums.size();
+
+    beginInsertRows({}, firstNewRow, firstNewRow + validAlbums.size() - 1);
+    d->mAllAlbums += validAlbums;
+    updateAlbumsRow(firstNewRow);
+    endInsertRows();
 }
 
 void AllAlbumsModel::albumRemoved(const MusicAlbum &removedAlbum)
 {
-    auto removedAlbumIterator = std::find(d->mAllAlbums.begin(), d->mAllAlbums.end(), removedAlbum);
+    albumsRemoved({removedAlbum});
+}
+
+void AllAlbumsModel::albumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    if (d->mDatabase) {
+        d->mRefreshTimer.start();
+        return;
+    }
+
+    auto removedRows = QVector<int>();
+    removedRows.reserve(removedAlbums.size());
 
-    if (removedAlbumIterator == d->mAllAlbums.end()) {
+    for (const auto &oneAlbum : removedAlbums) {
+        const auto albumRow = rowFromAlbum(oneAlbum);
+
+        if (albumRow != -1) {
+            removedRows.push_back(albumRow);
+        }
+    }
+
+    if (removedRows.isEmpty()) {
         return;
     }
 
-    int albumIndex = removedAlbumIterator - d->mAllAlbums.begin();
+    std::sort(removedRows.begin(), removedRows.end());
+    removedRows.erase(std::unique(removedRows.begin(), removedRows.end()), removedRows.end());
+
+    auto lastRow = removedRows.size() - 1;
+    while (lastRow >= 0) {
+        auto firstRow = lastRow;
+        while (firstRow > 0 && removedRows[firstRow - 1] == removedRows[firstRow] - 1) {
+            --firstRow;
+        }
 
-    beginRemoveRows({}, albumIndex, albumIndex);
-    d->mAllAlbums.erase(removedAlbumIterator);
-    --d->mAlbumCount;
-    endRemoveRows();
+        const auto firstRemovedRow = removedRows[firstRow];
+        const auto removedCount = lastRow - firstRow + 1;
+
+        beginRemoveRows({}, firstRemovedRow, firstRemovedRow + removedCount - 1);
+        for (auto rowIndex = firstRemovedRow; rowIndex < firstRemovedRow + removedCount; ++rowIndex) {
+            d->mAlbumsRow.remove(d->mAllAlbums[rowIndex].databaseId());
+        }
+        d->mAllAlbums.remove(firstRemovedRow, removedCount);
+        endRemoveRows();
+
+        lastRow = firstRow - 1;
+    }
+
+    updateAlbumsRow(removedRows.first());
 }
 
 void AllAlbumsModel::albumModified(const MusicAlbum &modifiedAlbum)
 {
-    auto modifiedAlbumIterator = std::find(d->mAllAlbums.begin(), d->mAllAlbums.end(), modifiedAlbum);
+    albumsModified({modifiedAlbum});
+}
+
+void AllAlbumsModel::albumsModified(const QList<MusicAlbum> &modifiedAlbums)
+{
+    auto modifiedRows = QVector<int>();
+    modifiedRows.reserve(modifiedAlbums.size());
+
+    if (d->mDatabase && (isFiltered() || !isWindowed())) {
+        d->mRefreshTimer.start();
+        return;
+    }
+
+    if (d->mDatabase) {
+        modifiedRows = d->mAlbumsWindows.replaceEntities(modifiedAlbums);
+    } else {
+        for (const auto &oneAlbum : modifiedAlbums) {
+            const auto albumRow = rowFromAlbum(oneAlbum);
+
+            if (albumRow == -1) {
+                continue;
+            }
+
+            d->mAllAlbums[albumRow] = oneAlbum;
+            modifiedRows.push_back(albumRow);
+        }
+    }
+
+    if (modifiedRows.isEmpty()) {
+        return;
+    }
+
+    std::sort(modifiedRows.begin(), modifiedRows.end());
+
+    auto firstRow = 0;
+    while (firstRow < modifiedRows.size()) {
+        auto lastRow = firstRow;
+        while (lastRow + 1 < modifiedRows.size() && modifiedRows[lastRow + 1] <= modifiedRows[lastRow] + 1) {
+            ++lastRow;
+        }
+
+        Q_EMIT dataChanged(index(modifiedRows[firstRow], 0), index(modifiedRows[lastRow], 0));
+
+        firstRow = lastRow + 1;
+    }
+}
+
+int AllAlbumsModel::rowFromAlbum(const MusicAlbum &album) const
+{
+    if (album.databaseId() != 0) {
+        return d->mAlbumsRow.value(album.databaseId(), -1);
+    }
+
+    auto albumIterator = std::find(d->mAllAlbums.begin(), d->mAllAlbums.end(), album);
+
+    if (albumIterator == d->mAllAlbums.end()) {
+        return -1;
+    }
+
+    return albumIterator - d->mAllAlbums.begin();
+}
+
+void AllAlbumsModel::updateAlbumsRow(int firstRow)
+{
+    for (auto rowIndex = firstRow; rowIndex < d->mAllAlbums.size(); ++rowIndex) {
+        const auto albumId = d->mAllAlbums[rowIndex].databaseId();
+
+        if (albumId != 0) {
+            d->mAlbumsRow[albumId] = rowIndex;
+        }
+    }
+}
+
+void AllAlbumsModel::setDatabase(DatabaseInterface *database)
+{
+    if (d->mDatabase == database) {
+        return;
+    }
+
+    if (d->mDatabase) {
+        disconnect(d->mDatabase, 0, this, 0);
+        disconnect(this, 0, d->mDatabase, 0);
+    }
+
+    beginResetModel();
+
+    d->mDatabase = database;
+
+    d->mAllAlbums.clear();
+    d->mAlbumsRow.clear();
+
+    d->mAlbumsWindows.clear();
+
+    endResetModel();
+
+    if (d->mDatabase) {
+        connect(this, &AllAlbumsModel::fetchAlbumsWindow,
+                d->mDatabase, &DatabaseInterface::fetchAlbumsWindow);
+        connect(d->mDatabase, &DatabaseInterface::albumsWindow,
+                this, &AllAlbumsModel::albumsWindow);
+        connect(this, &AllAlbumsModel::fetchArtistAlbums,
+                d->mDatabase, &DatabaseInterface::fetchArtistAlbums);
+        connect(d->mDatabase, &DatabaseInterface::artistAlbums,
+                this, &AllAlbumsModel::artistAlbums);
+        connect(d->mDatabase, &DatabaseInterface::albumsAdded,
+                this, &AllAlbumsModel::albumsAdded);
+        connect(d->mDatabase, &DatabaseInterface::albumsRemoved,
+                this, &AllAlbumsModel::albumsRemoved);
+        connect(d->mDatabase, &DatabaseInterface::albumsModified,
+                this, &AllAlbumsModel::albumsModified);
+
+        if (isWindowed()) {
+            d->mAlbumsWindows.wantWindow(0);
+            d->mFetchTimer.start();
+        } else {
+            Q_EMIT fetchArtistAlbums(d->mArtistId);
+        }
+    }
+
+    Q_EMIT databaseChanged();
+}
+
+void AllAlbumsModel::setFilterText(const QString &filterText)
+{
+    if (d->mFilterText == filterText) {
+        return;
+    }
+
+    d->mFilterText = filterText;
+
+    resetWindows();
+
+    Q_EMIT filterTextChanged(d->mFilterText);
+}
+
+void AllAlbumsModel::setFilterRating(int filterRating)
+{
+    if (d->mFilterRating == filterRating) {
+        return;
+    }
+
+    d->mFilterRating = filterRating;
+
+    resetWindows();
+
+    Q_EMIT filterRatingChanged(d->mFilterRating);
+}
+
+void AllAlbumsModel::setArtistId(qulonglong artistId)
+{
+    if (d->mArtistId == artistId) {
+        return;
+    }
+
+    beginResetModel();
+
+    d->mArtistId = artistId;
+
+    d->mAllAlbums.clear();
+    d->mAlbumsRow.clear();
+
+    d->mAlbumsWindows.clear();
+
+    endResetModel();
+
+    if (d->mDatabase) {
+        if (isWindowed()) {
+            d->mAlbumsWindows.wantWindow(0);
+            d->mFetchTimer.start();
+        } else {
+            Q_EMIT fetchArtistAlbums(d->mArtistId);
+        }
+    }
+
+    Q_EMIT artistIdChanged(d->mArtistId);
+}
+
+void AllAlbumsModel::albumsWindow(const QString &filterText, int filterRating, int albumsCount, int offset, const QList<MusicAlbum> &albums)
+{
+    if (!isWindowed()) {
+        return;
+    }
+
+    if (filterText != d->mFilterText || filterRating != d->mFilterRating) {
+        return;
+    }
+
+    const auto windowIndex = offset / d->mAlbumsWindows.windowSize();
+    const auto currentCount = d->mAlbumsWindows.entitiesCount();
+
+    // the database could not read this window, let the next access fetch it again
+    if (albumsCount < 0) {
+        d->mAlbumsWindows.cancelWindow(windowIndex);
+        return;
+    }
+
+    // a window only tells the new count, not where rows were added or
+    // removed, so the loaded rows cannot be moved to their new place
+    if (albumsCount != currentCount) {
+        beginResetModel();
+        d->mAlbumsWindows.setEntitiesCount(albumsCount);
+        d->mAlbumsWindows.refreshOtherWindows(windowIndex);
+        d->mAlbumsWindows.setWindow(windowIndex, albums);
+        endResetModel();
+
+        if (d->mAlbumsWindows.hasWantedWindows()) {
+            d->mFetchTimer.start();
+        }
+
+        return;
+    }
+
+    d->mAlbumsWindows.setWindow(windowIndex, albums);
+
+    if (d->mAlbumsWindows.hasWantedWindows()) {
+        d->mFetchTimer.start();
+    }
+
+    const auto lastRow = std::min(offset + albums.size(), albumsCount) - 1;
 
-    if (modifiedAlbumIterator == d->mAllAlbums.end()) {
+    if (lastRow >= offset) {
+        Q_EMIT dataChanged(index(offset, 0), index(lastRow, 0));
+    }
+}
+
+void AllAlbumsModel::artistAlbums(qulonglong artistId, const QList<MusicAlbum> &albums)
+{
+    if (!d->mDatabase || isWindowed() || artistId != d->mArtistId) {
+        return;
+    }
+
+    auto sameAlbums = (albums.size() == d->mAllAlbums.size());
+
+    for (auto rowIndex = 0; sameAlbums && rowIndex < albums.size(); ++rowIndex) {
+        sameAlbums = (albums[rowIndex].databaseId() == d->mAllAlbums[rowIndex].databaseId());
+    }
+
+    if (sameAlbums) {
+        if (albums.isEmpty()) {
+            return;
+        }
+
+        d->mAllAlbums = albums.toVector();
+
+        Q_EMIT dataChanged(index(0, 0), index(d->mAllAlbums.size() - 1, 0));
+
+        return;
+    }
+
+    beginResetModel();
+
+    d->mAllAlbums = albums.toVector();
+    d->mAlbumsRow.clear();
+    updateAlbumsRow(0);
+
+    endResetModel();
+}
+
+const MusicAlbum *AllAlbumsModel::albumFromRow(int row) const
+{
+    if (!isWindowed()) {
+        return &d->mAllAlbums[row];
+    }
+
+    const auto album = d->mAlbumsWindows.entityFromRow(row);
+
+    if (d->mAlbumsWindows.hasWantedWindows()) {
+        d->mFetchTimer.start();
+    }
+
+    return album;
+}
+
+void AllAlbumsModel::requestWindows()
+{
+    const auto wantedWindows = d->mAlbumsWindows.takeWantedWindows();
+
+    for (auto windowIndex : wantedWindows) {
+        Q_EMIT fetchAlbumsWindow(d->mFilterText, d->mFilterRating,
+                                 windowIndex * d->mAlbumsWindows.windowSize(), d->mAlbumsWindows.windowSize());
+    }
+}
+
+void AllAlbumsModel::refreshWindows()
+{
+    if (!isWindowed()) {
+        if (d->mDatabase) {
+            Q_EMIT fetchArtistAlbums(d->mArtistId);
+        }
+
+        return;
+    }
+
+    d->mAlbumsWindows.refreshWindows();
+
+    requestWindows();
+}
+
+bool AllAlbumsModel::isFiltered() const
+{
+    return !d->mFilterText.trimmed().isEmpty() || d->mFilterRating > 0;
+}
+
+bool AllAlbumsModel::isWindowed() const
+{
+    return d->mDatabase && d->mArtistId == 0;
+}
+
+void AllAlbumsModel::resetWindows()
+{
+    if (!isWindowed()) {
         return;
     }
 
-    int albumIndex = modifiedAlbumIterator - d->mAllAlbums.begin();
-    d->mAllAlbums[albumIndex] = modifiedAlbum;
+    beginResetModel();
+    d->mAlbumsWindows.clear();
+    endResetModel();
 
-    Q_EMIT dataChanged(index(albumIndex, 0), index(albumIndex, 0));
+    d->mAlbumsWindows.wantWindow(0);
+    d->mFetchTimer.start();
 }
 
 #include "moc_allalbumsmodel.cpp"
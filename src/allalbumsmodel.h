@@ -22,6 +22,7 @@
 
 #include <QAbstractItemModel>
 #include <QVector>
+#include <QList>
 #include <QHash>
 #include <QString>
 
@@ -30,12 +31,33 @@
 
 class AllAlbumsModelPrivate;
 class MusicStatistics;
+class DatabaseInterface;
 class QMutex;
 
 class AllAlbumsModel : public QAbstractItemModel
 {
     Q_OBJECT
 
+    Q_PROPERTY(DatabaseInterface* database
+               READ database
+               WRITE setDatabase
+               NOTIFY databaseChanged)
+
+    Q_PROPERTY(QString filterText
+               READ filterText
+               WRITE setFilterText
+               NOTIFY filterTextChanged)
+
+    Q_PROPERTY(int filterRating
+               READ filterRating
+               WRITE setFilterRating
+               NOTIFY filterRatingChanged)
+
+    Q_PROPERTY(qulonglong artistId
+               READ artistId
+               WRITE setArtistId
+               NOTIFY artistIdChanged)
+
 public:
 
     enum ColumnsRoles {
@@ -49,6 +71,7 @@ public:
         IsSingleDiscAlbumRole = IdRole + 1,
         AlbumDataRole = IsSingleDiscAlbumRole + 1,
         HighestTrackRating = AlbumDataRole + 1,
+        DatabaseIdRole = HighestTrackRating + 1,
     };
 
     Q_ENUM(ColumnsRoles)
@@ -71,17 +94,73 @@ public:
 
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
 
+    DatabaseInterface* database() const;
+
+    QString filterText() const;
+
+    int filterRating() const;
+
+    qulonglong artistId() const;
+
+Q_SIGNALS:
+
+    void databaseChanged();
+
+    void filterTextChanged(const QString &filterText);
+
+    void filterRatingChanged(int filterRating);
+
+    void artistIdChanged(qulonglong artistId);
+
+    void fetchAlbumsWindow(const QString &filterText, int filterRating, int offset, int count);
+
+    void fetchArtistAlbums(qulonglong artistId);
+
 public Q_SLOTS:
 
     void albumAdded(const MusicAlbum &newAlbum);
 
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
+
     void albumRemoved(const MusicAlbum &removedAlbum);
 
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
+
     void albumModified(const MusicAlbum &modifiedAlbum);
 
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
+
+    void setDatabase(DatabaseInterface *database);
+
+    void setFilterText(const QString &filterText);
+
+    void setFilterRating(int filterRating);
+
+    void setArtistId(qulonglong artistId);
+
+    void albumsWindow(const QString &filterText, int filterRating, int albumsCount, int offset, const QList<MusicAlbum> &albums);
+
+    void artistAlbums(qulonglong artistId, const QList<MusicAlbum> &albums);
+
 private:
 
-    QVariant internalDataAlbum(int albumIndex, int role) const;
+    QVariant internalDataAlbum(const MusicAlbum &album, int role) const;
+
+    const MusicAlbum* albumFromRow(int row) const;
+
+    void requestWindows();
+
+    void refreshWindows();
+
+    bool isFiltered() const;
+
+    bool isWindowed() const;
+
+    void resetWindows();
+
+    int rowFromAlbum(const MusicAlbum &album) const;
+
+    void updateAlbumsRow(int firstRow);
 
     AllAlbumsModelPrivate *d;
 
@@ -20,11 +20,15 @@
 #include "allartistsmodel.h"
 #include "databaseinterface.h"
 #include "musicartist.h"
+#include "entitieswindows.h"
 
 #include <QUrl>
 #include <QTimer>
 #include <QPointer>
 #include <QVector>
+#include <QHash>
+
+#include <algorithm>
 
 class AllArtistsModelPrivate
 {
@@ -36,14 +40,29 @@ public:
 
     QVector<MusicArtist> mAllArtists;
 
-    int mArtistsCount = 0;
+    QHash<qulonglong, int> mArtistsRow;
 
     bool mUseLocalIcons = false;
 
+    QPointer<DatabaseInterface> mDatabase;
+
+    EntitiesWindows<MusicArtist> mArtistsWindows;
+
+    QTimer mFetchTimer;
+
+    QTimer mRefreshTimer;
+
 };
 
 AllArtistsModel::AllArtistsModel(QObject *parent) : QAbstractItemModel(parent), d(new AllArtistsModelPrivate)
 {
+    d->mFetchTimer.setSingleShot(true);
+    d->mFetchTimer.setInterval(0);
+    connect(&d->mFetchTimer, &QTimer::timeout, this, &AllArtistsModel::requestWindows);
+
+    d->mRefreshTimer.setSingleShot(true);
+    d->mRefreshTimer.setInterval(100);
+    connect(&d->mRefreshTimer, &QTimer::timeout, this, &AllArtistsModel::refreshWindows);
 }
 
 AllArtistsModel::~AllArtistsModel()
@@ -59,7 +78,11 @@ int AllArtistsModel::rowCount(const QModelIndex &parent) const
         return artistCount;
     }
 
-    artistCount = d->mArtistsCount;
+    if (d->mDatabase) {
+        artistCount = d->mArtistsWindows.entitiesCount();
+    } else {
+        artistCount = d->mAllArtists.size();
+    }
 
     return artistCount;
 }
@@ -72,6 +95,7 @@ QHash<int, QByteArray> AllArtistsModel::roleNames() const
     roles[static_cast<int>(ColumnsRoles::ArtistsCountRole)] = "albumsCount";
     roles[static_cast<int>(ColumnsRoles::ImageRole)] = "image";
     roles[static_cast<int>(ColumnsRoles::IdRole)] = "id";
+    roles[static_cast<int>(ColumnsRoles::DatabaseIdRole)] = "databaseId";
 
     return roles;
 }
@@ -89,7 +113,7 @@ QVariant AllArtistsModel::data(const QModelIndex &index, int role) const
 {
     auto result = QVariant();
 
-    const auto artistsCount = d->mArtistsCount;
+    const auto artistsCount = rowCount();
 
     if (!index.isValid()) {
         return result;
@@ -115,20 +139,29 @@ QVariant AllArtistsModel::data(const QModelIndex &index, int role) const
         return result;
     }
 
+    const auto artist = artistFromRow(index.row());
+
+    if (!artist) {
+        return result;
+    }
+
     ColumnsRoles convertedRole = static_cast<ColumnsRoles>(role);
 
     switch(convertedRole)
     {
     case ColumnsRoles::NameRole:
-        result = d->mAllArtists[index.row()].name();
+        result = artist->name();
         break;
     case ColumnsRoles::ArtistsCountRole:
-        result = d->mAllArtists[index.row()].albumsCount();
+        result = artist->albumsCount();
         break;
     case ColumnsRoles::ImageRole:
         break;
     case ColumnsRoles::IdRole:
         break;
+    case ColumnsRoles::DatabaseIdRole:
+        result = artist->databaseId();
+        break;
     }
 
     return result;
@@ -167,35 +200,254 @@ int AllArtistsModel::columnCount(const QModelIndex &parent) const
     return 1;
 }
 
+DatabaseInterface *AllArtistsModel::database() const
+{
+    return d->mDatabase;
+}
+
 void AllArtistsModel::artistAdded(const MusicArtist &newArtist)
 {
-    if (newArtist.isValid()) {
-        beginInsertRows({}, d->mAllArtists.size(), d->mAllArtists.size());
-        d->mAllArtists.push_back(newArtist);
-        ++d->mArtistsCount;
-        endInsertRows();
+    artistsAdded({newArtist});
+}
+
+void AllArtistsModel::artistsAdded(const QList<MusicArtist> &newArtists)
+{
+    if (d->mDatabase) {
+        d->mRefreshTimer.start();
+        return;
     }
+
+    auto validArtists = QVector<MusicArtist>();
+    validArtists.reserve(newArtists.size());
+
+    for (const auto &oneArtist : newArtists) {
+        if (oneArtist.isValid()) {
+            validArtists.push_back(oneArtist);
+        }
+    }
+
+    if (validArtists.isEmpty()) {
+        return;
+    }
+
+    const auto firstNewRow = d->mAllArtists.size();
+
+    beginInsertRows({}, firstNewRow, firstNewRow + validArtists.size() - 1);
+    d->mAllArtists += validArtists;
+    updateArtistsRow(firstNewRow);
+    endInsertRows();
 }
 
 void AllArtistsModel::artistRemoved(const MusicArtist &removedArtist)
 {
-    auto removedArtistIterator = std::find(d->mAllArtists.begin(), d->mAllArtists.end(), removedArtist);
+    artistsRemoved({removedArtist});
+}
 
-    if (removedArtistIterator == d->mAllArtists.end()) {
+void AllArtistsModel::artistsRemoved(const QList<MusicArtist> &removedArtists)
+{
+    if (d->mDatabase) {
+        d->mRefreshTimer.start();
         return;
     }
 
-    int artistIndex = removedArtistIterator - d->mAllArtists.begin();
+    auto removedRows = QVector<int>();
+    removedRows.reserve(removedArtists.size());
+
+    for (const auto &oneArtist : removedArtists) {
+        const auto artistRow = rowFromArtist(oneArtist);
 
-    beginRemoveRows({}, artistIndex, artistIndex);
-    d->mAllArtists.erase(removedArtistIterator);
-    --d->mArtistsCount;
-    endRemoveRows();
+        if (artistRow != -1) {
+            removedRows.push_back(artistRow);
+        }
+    }
+
+    if (removedRows.isEmpty()) {
+        return;
+    }
+
+    std::sort(removedRows.begin(), removedRows.end());
+    removedRows.erase(std::unique(removedRows.begin(), removedRows.end()), removedRows.end());
+
+    auto lastRow = removedRows.size() - 1;
+    while (lastRow >= 0) {
+        auto firstRow = lastRow;
+        while (firstRow > 0 && removedRows[firstRow - 1] == removedRows[firstRow] - 1) {
+            --firstRow;
+        }
+
+        const auto firstRemovedRow = removedRows[firstRow];
+        const auto removedCount = lastRow - firstRow + 1;
+
+        beginRemoveRows({}, firstRemovedRow, firstRemovedRow + removedCount - 1);
+        for (auto rowIndex = firstRemovedRow; rowIndex < firstRemovedRow + removedCount; ++rowIndex) {
+            d->mArtistsRow.remove(d->mAllArtists[rowIndex].databaseId());
+        }
+        d->mAllArtists.remove(firstRemovedRow, removedCount);
+        endRemoveRows();
+
+        lastRow = firstRow - 1;
+    }
+
+    updateArtistsRow(removedRows.first());
 }
 
 void AllArtistsModel::artistModified(const MusicArtist &modifiedArtist)
 {
-    Q_UNUSED(modifiedArtist);
+    if (d->mDatabase) {
+        const auto modifiedRows = d->mArtistsWindows.replaceEntities({modifiedArtist});
+
+        for (auto artistRow : modifiedRows) {
+            Q_EMIT dataChanged(index(artistRow, 0), index(artistRow, 0));
+        }
+
+        return;
+    }
+
+    const auto artistRow = rowFromArtist(modifiedArtist);
+
+    if (artistRow == -1) {
+        return;
+    }
+
+    d->mAllArtists[artistRow] = modifiedArtist;
+
+    Q_EMIT dataChanged(index(artistRow, 0), index(artistRow, 0));
+}
+
+int AllArtistsModel::rowFromArtist(const MusicArtist &artist) const
+{
+    if (artist.databaseId() != 0) {
+        return d->mArtistsRow.value(artist.databaseId(), -1);
+    }
+
+    auto artistIterator = std::find(d->mAllArtists.begin(), d->mAllArtists.end(), artist);
+
+    if (artistIterator == d->mAllArtists.end()) {
+        return -1;
+    }
+
+    return artistIterator - d->mAllArtists.begin();
+}
+
+void AllArtistsModel::updateArtistsRow(int firstRow)
+{
+    for (auto rowIndex = firstRow; rowIndex < d->mAllArtists.size(); ++rowIndex) {
+        const auto artistId = d->mAllArtists[rowIndex].databaseId();
+
+        if (artistId != 0) {
+            d->mArtistsRow[artistId] = rowIndex;
+        }
+    }
+}
+
+void AllArtistsModel::setDatabase(DatabaseInterface *database)
+{
+    if (d->mDatabase == database) {
+        return;
+    }
+
+    if (d->mDatabase) {
+        disconnect(d->mDatabase, 0, this, 0);
+        disconnect(this, 0, d->mDatabase, 0);
+    }
+
+    beginResetModel();
+
+    d->mDatabase = database;
+
+    d->mAllArtists.clear();
+    d->mArtistsRow.clear();
+
+    d->mArtistsWindows.clear();
+
+    endResetModel();
+
+    if (d->mDatabase) {
+        connect(this, &AllArtistsModel::fetchArtistsWindow,
+                d->mDatabase, &DatabaseInterface::fetchArtistsWindow);
+        connect(d->mDatabase, &DatabaseInterface::artistsWindow,
+                this, &AllArtistsModel::artistsWindow);
+
+        d->mArtistsWindows.wantWindow(0);
+        d->mFetchTimer.start();
+    }
+
+    Q_EMIT databaseChanged();
+}
+
+void AllArtistsModel::artistsWindow(int artistsCount, int offset, const QList<MusicArtist> &artists)
+{
+    if (!d->mDatabase) {
+        return;
+    }
+
+    const auto windowIndex = offset / d->mArtistsWindows.windowSize();
+    const auto currentCount = d->mArtistsWindows.entitiesCount();
+
+    // the database could not read this window, let the next access fetch it again
+    if (artistsCount < 0) {
+        d->mArtistsWindows.cancelWindow(windowIndex);
+        return;
+    }
+
+    // a window only tells the new count, not where rows were added or
+    // removed, so the loaded rows cannot be moved to their new place
+    if (artistsCount != currentCount) {
+        beginResetModel();
+        d->mArtistsWindows.setEntitiesCount(artistsCount);
+        d->mArtistsWindows.refreshOtherWindows(windowIndex);
+        d->mArtistsWindows.setWindow(windowIndex, artists);
+        endResetModel();
+
+        if (d->mArtistsWindows.hasWantedWindows()) {
+            d->mFetchTimer.start();
+        }
+
+        return;
+    }
+
+    d->mArtistsWindows.setWindow(windowIndex, artists);
+
+    if (d->mArtistsWindows.hasWantedWindows()) {
+        d->mFetchTimer.start();
+    }
+
+    const auto lastRow = std::min(offset + artists.size(), artistsCount) - 1;
+
+    if (lastRow >= offset) {
+        Q_EMIT dataChanged(index(offset, 0), index(lastRow, 0));
+    }
+}
+
+const MusicArtist *AllArtistsModel::artistFromRow(int row) const
+{
+    if (!d->mDatabase) {
+        return &d->mAllArtists[row];
+    }
+
+    const auto artist = d->mArtistsWindows.entityFromRow(row);
+
+    if (d->mArtistsWindows.hasWantedWindows()) {
+        d->mFetchTimer.start();
+    }
+
+    return artist;
+}
+
+void AllArtistsModel::requestWindows()
+{
+    const auto wantedWindows = d->mArtistsWindows.takeWantedWindows();
+
+    for (auto windowIndex : wantedWindows) {
+        Q_EMIT fetchArtistsWindow(windowIndex * d->mArtistsWindows.windowSize(), d->mArtistsWindows.windowSize());
+    }
+}
+
+void AllArtistsModel::refreshWindows()
+{
+    d->mArtistsWindows.refreshWindows();
+
+    requestWindows();
 }
 
 #include "moc_allartistsmodel.cpp"
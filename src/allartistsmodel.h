@@ -22,6 +22,7 @@
 
 #include <QAbstractItemModel>
 #include <QVector>
+#include <QList>
 #include <QHash>
 #include <QString>
 
@@ -34,6 +35,11 @@ class AllArtistsModel : public QAbstractItemModel
 {
     Q_OBJECT
 
+    Q_PROPERTY(DatabaseInterface* database
+               READ database
+               WRITE setDatabase
+               NOTIFY databaseChanged)
+
 public:
 
     enum ColumnsRoles {
@@ -41,6 +47,7 @@ public:
         ArtistsCountRole = NameRole + 1,
         ImageRole = ArtistsCountRole + 1,
         IdRole = ImageRole + 1,
+        DatabaseIdRole = IdRole + 1,
     };
 
     Q_ENUM(ColumnsRoles)
@@ -63,16 +70,42 @@ public:
 
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
 
+    DatabaseInterface* database() const;
+
+Q_SIGNALS:
+
+    void databaseChanged();
+
+    void fetchArtistsWindow(int offset, int count);
+
 public Q_SLOTS:
 
     void artistAdded(const MusicArtist &newArtist);
 
+    void artistsAdded(const QList<MusicArtist> &newArtists);
+
     void artistRemoved(const MusicArtist &removedArtist);
 
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
+
     void artistModified(const MusicArtist &modifiedArtist);
 
+    void setDatabase(DatabaseInterface *database);
+
+    void artistsWindow(int artistsCount, int offset, const QList<MusicArtist> &artists);
+
 private:
 
+    const MusicArtist* artistFromRow(int row) const;
+
+    void requestWindows();
+
+    void refreshWindows();
+
+    int rowFromArtist(const MusicArtist &artist) const;
+
+    void updateArtistsRow(int firstRow);
+
     AllArtistsModelPrivate *d;
 
 };
@@ -78,6 +78,7 @@ ApplicationWindow {
         onMutedChanged: playControlItem.muted = muted
 
         source: manageAudioPlayer.playerSource
+        nextSource: manageAudioPlayer.nextPlayerSource
 
         onPlaying: {
             myPlayControlManager.playerPlaying()
@@ -135,6 +136,7 @@ ApplicationWindow {
         id: manageAudioPlayer
 
         currentTrack: playListControlerItem.currentTrack
+        nextTrack: playListControlerItem.nextTrack
         playListModel: playListModelItem
         urlRole: MediaPlayList.ResourceRole
         isPlayingRole: MediaPlayList.IsPlayingRole
@@ -145,6 +147,7 @@ ApplicationWindow {
         audioDuration: audioPlayer.duration
         playerIsSeekable: audioPlayer.seekable
         playerPosition: audioPlayer.position
+        positionUpdatesEnabled: mainWindow.visibility !== Window.Hidden && mainWindow.visibility !== Window.Minimized
 
         persistentState: persistentSettings.audioPlayerState
 
@@ -152,6 +155,7 @@ ApplicationWindow {
         onPlayerPause: audioPlayer.pause()
         onPlayerStop: audioPlayer.stop()
         onSkipNextTrack: playListControlerItem.skipNextTrack()
+        onPrepareNextTrack: playListControlerItem.prepareNextTrack()
         onSeek: audioPlayer.seek(position)
     }
 
@@ -169,19 +173,19 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onAlbumAdded: allAlbumsModel.albumAdded(newAlbum)
+        onAlbumsAdded: allAlbumsModel.albumsAdded(newAlbums)
     }
 
     Connections {
         target: allListeners
 
-        onAlbumRemoved: allAlbumsModel.albumRemoved(removedAlbum)
+        onAlbumsRemoved: allAlbumsModel.albumsRemoved(removedAlbums)
     }
 
     Connections {
         target: allListeners
 
-        onAlbumModified: allAlbumsModel.albumModified(modifiedAlbum)
+        onAlbumsModified: allAlbumsModel.albumsModified(modifiedAlbums)
     }
 
     AllArtistsModel {
@@ -191,19 +195,13 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onArtistAdded: allArtistsModel.artistAdded(newArtist)
+        onArtistsAdded: allArtistsModel.artistsAdded(newArtists)
     }
 
     Connections {
         target: allListeners
 
-        onArtistRemoved: allArtistsModel.artistRemoved(removedArtist)
-    }
-
-    Connections {
-        target: allListeners
-
-        onArtistModified: allArtistsModel.artistModified(modifiedArtist)
+        onArtistsRemoved: allArtistsModel.artistsRemoved(removedArtists)
     }
 
     Rectangle {
@@ -249,7 +247,7 @@ ApplicationWindow {
 
                 volume: persistentSettings.playControlItemVolume
                 muted: persistentSettings.playControlItemMuted
-                position: audioPlayer.position
+                position: manageAudioPlayer.playControlPosition
                 skipBackwardEnabled: myPlayControlManager.skipBackwardControlEnabled
                 skipForwardEnabled: myPlayControlManager.skipForwardControlEnabled
                 playEnabled: myPlayControlManager.playControlEnabled
@@ -260,7 +258,7 @@ ApplicationWindow {
                 Layout.maximumHeight: Layout.preferredHeight
                 Layout.fillWidth: true
 
-                onSeek: audioPlayer.seek(position)
+                onSeek: manageAudioPlayer.playerSeek(position)
 
                 onPlay: manageAudioPlayer.playPause()
                 onPause: manageAudioPlayer.playPause()
@@ -21,6 +21,8 @@
 
 #include <QTimer>
 
+#include <utility>
+
 #include "config-upnp-qt.h"
 
 class AudioWrapperPrivate
@@ -28,23 +30,20 @@ class AudioWrapperPrivate
 
 public:
 
-    QMediaPlayer mPlayer;
+    QMediaPlayer mFirstPlayer;
+
+    QMediaPlayer mSecondPlayer;
+
+    QMediaPlayer *mPlayer = &mFirstPlayer;
+
+    QMediaPlayer *mNextPlayer = &mSecondPlayer;
 
 };
 
 
 AudioWrapper::AudioWrapper(QObject *parent) : QObject(parent), d(new AudioWrapperPrivate)
 {
-    connect(&d->mPlayer, &QMediaPlayer::mutedChanged, this, &AudioWrapper::playerMutedChanged);
-    connect(&d->mPlayer, &QMediaPlayer::volumeChanged, this, &AudioWrapper::playerVolumeChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaChanged, this, &AudioWrapper::sourceChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::statusChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playbackStateChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playerStateChanged);
-    connect(&d->mPlayer, SIGNAL(error(QMediaPlayer::Error)), this, SIGNAL(errorChanged()));
-    connect(&d->mPlayer, &QMediaPlayer::durationChanged, this, &AudioWrapper::durationChanged);
-    connect(&d->mPlayer, &QMediaPlayer::positionChanged, this, &AudioWrapper::positionChanged);
-    connect(&d->mPlayer, &QMediaPlayer::seekableChanged, this, &AudioWrapper::seekableChanged);
+    connectPlayer();
 }
 
 AudioWrapper::~AudioWrapper()
@@ -54,102 +53,129 @@ AudioWrapper::~AudioWrapper()
 
 bool AudioWrapper::muted() const
 {
-    return d->mPlayer.isMuted();
+    return d->mPlayer->isMuted();
 }
 
 int AudioWrapper::volume() const
 {
-    return d->mPlayer.volume();
+    return d->mPlayer->volume();
 }
 
 QUrl AudioWrapper::source() const
 {
-    return d->mPlayer.media().canonicalUrl();
+    return d->mPlayer->media().canonicalUrl();
+}
+
+QUrl AudioWrapper::nextSource() const
+{
+    return d->mNextPlayer->media().canonicalUrl();
 }
 
 QString AudioWrapper::error() const
 {
-    return d->mPlayer.errorString();
+    return d->mPlayer->errorString();
 }
 
 qint64 AudioWrapper::duration() const
 {
-    return d->mPlayer.duration();
+    return d->mPlayer->duration();
 }
 
 qint64 AudioWrapper::position() const
 {
-    return d->mPlayer.position();
+    return d->mPlayer->position();
 }
 
 bool AudioWrapper::seekable() const
 {
-    return d->mPlayer.isSeekable();
+    return d->mPlayer->isSeekable();
 }
 
 QAudio::Role AudioWrapper::audioRole() const
 {
-    return d->mPlayer.audioRole();
+    return d->mPlayer->audioRole();
 }
 
 QMediaPlayer::State AudioWrapper::playbackState() const
 {
-    return d->mPlayer.state();
+    return d->mPlayer->state();
 }
 
 QMediaPlayer::MediaStatus AudioWrapper::status() const
 {
-    return d->mPlayer.mediaStatus();
+    return d->mPlayer->mediaStatus();
 }
 
 void AudioWrapper::setMuted(bool muted)
 {
-    d->mPlayer.setMuted(muted);
+    d->mPlayer->setMuted(muted);
+    d->mNextPlayer->setMuted(muted);
 }
 
 void AudioWrapper::setVolume(int volume)
 {
-    d->mPlayer.setVolume(volume);
+    d->mPlayer->setVolume(volume);
+    d->mNextPlayer->setVolume(volume);
 }
 
 void AudioWrapper::setSource(const QUrl &source)
 {
-    d->mPlayer.setMedia({source});
+    if (switchToNextPlayer(source)) {
+        return;
+    }
+
+    d->mPlayer->setMedia({source});
+}
+
+void AudioWrapper::setNextSource(const QUrl &nextSource)
+{
+    if (nextSource == d->mNextPlayer->media().canonicalUrl()) {
+        return;
+    }
+
+    if (nextSource.isEmpty()) {
+        d->mNextPlayer->setMedia(QMediaContent());
+    } else {
+        d->mNextPlayer->setMedia({nextSource});
+    }
+
+    Q_EMIT nextSourceChanged();
 }
 
 void AudioWrapper::setPosition(qint64 position)
 {
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::play()
 {
-    d->mPlayer.play();
+    d->mPlayer->play();
 }
 
 void AudioWrapper::pause()
 {
-    d->mPlayer.pause();
+    d->mPlayer->pause();
 }
 
 void AudioWrapper::stop()
 {
-    d->mPlayer.stop();
+    d->mPlayer->stop();
 }
 
 void AudioWrapper::seek(int position)
 {
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::setAudioRole(QAudio::Role audioRole)
 {
-    d->mPlayer.setAudioRole(audioRole);
+    d->mPlayer->setAudioRole(audioRole);
+    d->mNextPlayer->setAudioRole(audioRole);
 }
 
 void AudioWrapper::playerStateChanged()
 {
-    switch(d->mPlayer.state())
+    switch(d->mPlayer->state())
     {
     case QMediaPlayer::State::StoppedState:
         Q_EMIT stopped();
@@ -173,5 +199,62 @@ void AudioWrapper::playerMutedChanged()
     QTimer::singleShot(0, [this]() {Q_EMIT mutedChanged();});
 }
 
+void AudioWrapper::connectPlayer()
+{
+    connect(d->mPlayer, &QMediaPlayer::mutedChanged, this, &AudioWrapper::playerMutedChanged);
+    connect(d->mPlayer, &QMediaPlayer::volumeChanged, this, &AudioWrapper::playerVolumeChanged);
+    connect(d->mPlayer, &QMediaPlayer::mediaChanged, this, &AudioWrapper::sourceChanged);
+    connect(d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::statusChanged);
+    connect(d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playbackStateChanged);
+    connect(d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playerStateChanged);
+    connect(d->mPlayer, SIGNAL(error(QMediaPlayer::Error)), this, SIGNAL(errorChanged()));
+    connect(d->mPlayer, &QMediaPlayer::durationChanged, this, &AudioWrapper::durationChanged);
+    connect(d->mPlayer, &QMediaPlayer::positionChanged, this, &AudioWrapper::positionChanged);
+    connect(d->mPlayer, &QMediaPlayer::seekableChanged, this, &AudioWrapper::seekableChanged);
+}
+
+void AudioWrapper::disconnectPlayer()
+{
+    disconnect(d->mPlayer, nullptr, this, nullptr);
+}
+
+bool AudioWrapper::switchToNextPlayer(const QUrl &source)
+{
+    if (source.isEmpty() || source != d->mNextPlayer->media().canonicalUrl()) {
+        return false;
+    }
+
+    if (d->mPlayer->mediaStatus() != QMediaPlayer::EndOfMedia) {
+        return false;
+    }
+
+    switch (d->mNextPlayer->mediaStatus())
+    {
+    case QMediaPlayer::LoadedMedia:
+    case QMediaPlayer::BufferingMedia:
+    case QMediaPlayer::BufferedMedia:
+        break;
+    default:
+        return false;
+    }
+
+    disconnectPlayer();
+    std::swap(d->mPlayer, d->mNextPlayer);
+    connectPlayer();
+
+    d->mNextPlayer->setMedia(QMediaContent());
+
+    Q_EMIT sourceChanged();
+    Q_EMIT nextSourceChanged();
+    Q_EMIT statusChanged();
+    Q_EMIT durationChanged();
+    Q_EMIT positionChanged();
+    Q_EMIT seekableChanged();
+
+    d->mPlayer->play();
+
+    return true;
+}
+
 
 #include "moc_audiowrapper.cpp"
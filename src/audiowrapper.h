@@ -46,6 +46,11 @@ class AudioWrapper : public QObject
                WRITE setSource
                NOTIFY sourceChanged)
 
+    Q_PROPERTY(QUrl nextSource
+               READ nextSource
+               WRITE setNextSource
+               NOTIFY nextSourceChanged)
+
     Q_PROPERTY(QMediaPlayer::MediaStatus status
                READ status
                NOTIFY statusChanged)
@@ -88,6 +93,8 @@ public:
 
     QUrl source() const;
 
+    QUrl nextSource() const;
+
     QMediaPlayer::MediaStatus status() const;
 
     QMediaPlayer::State playbackState() const;
@@ -110,6 +117,8 @@ Q_SIGNALS:
 
     void sourceChanged();
 
+    void nextSourceChanged();
+
     void statusChanged();
 
     void playbackStateChanged();
@@ -138,6 +147,8 @@ public Q_SLOTS:
 
     void setSource(const QUrl &source);
 
+    void setNextSource(const QUrl &nextSource);
+
     void setPosition(qint64 position);
 
     void play();
@@ -160,6 +171,12 @@ private Q_SLOTS:
 
 private:
 
+    void connectPlayer();
+
+    void disconnectPlayer();
+
+    bool switchToNextPlayer(const QUrl &source);
+
     AudioWrapperPrivate *d = nullptr;
 
 };
@@ -135,10 +135,6 @@ MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
     auto fileName = scanFile.toLocalFile();
     auto scanFileInfo = QFileInfo(fileName);
 
-    if (scanFileInfo.exists()) {
-        watchPath(fileName);
-    }
-
     Baloo::File match(fileName);
     match.load();
 
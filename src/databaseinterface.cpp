@@ -29,11 +29,36 @@
 
 #include <QMutex>
 #include <QVariant>
+#include <QVector>
+#include <QPair>
+#include <QSet>
 #include <QAtomicInt>
+#include <QRegularExpression>
+#include <QStringList>
 #include <QDebug>
 
 #include <algorithm>
 
+class PendingTrackInsert
+{
+public:
+
+    MusicAudioTrack mTrack;
+
+    qulonglong mTrackId = 0;
+
+    qulonglong mAlbumId = 0;
+
+    qulonglong mArtistId = 0;
+
+    qulonglong mDiscoverId = 0;
+
+    bool mIsModified = false;
+
+    bool mIsReplaced = false;
+
+};
+
 class DatabaseInterfacePrivate
 {
 public:
@@ -52,10 +77,20 @@ public:
           mRemoveTrackQuery(mTracksDatabase), mRemoveAlbumQuery(mTracksDatabase),
           mRemoveArtistQuery(mTracksDatabase), mSelectAllTracksQuery(mTracksDatabase),
           mInsertTrackMapping(mTracksDatabase), mSelectAllTracksFromSourceQuery(mTracksDatabase),
+          mSelectAllTrackFilesFromSourceQuery(mTracksDatabase),
           mInsertMusicSource(mTracksDatabase), mSelectMusicSource(mTracksDatabase),
           mUpdateIsSingleDiscAlbumFromIdQuery(mTracksDatabase), mSelectAllInvalidTracksFromSourceQuery(mTracksDatabase),
           mInitialUpdateTracksValidity(mTracksDatabase), mUpdateTrackMapping(mTracksDatabase),
-          mSelectTracksMapping(mTracksDatabase), mSelectTracksMappingPriority(mTracksDatabase)
+          mSelectTracksMapping(mTracksDatabase), mSelectTracksMappingFromFileNamesQuery(mTracksDatabase),
+          mInsertTracksBatchQuery(mTracksDatabase), mInsertTracksMappingBatchQuery(mTracksDatabase),
+          mSelectArtistsPageQuery(mTracksDatabase),
+          mSelectAlbumsPageQuery(mTracksDatabase), mSelectTracksIdPageQuery(mTracksDatabase),
+          mSearchLibraryQuery(mTracksDatabase), mSelectAlbumsWindowQuery(mTracksDatabase),
+          mSelectAlbumsCountQuery(mTracksDatabase), mSelectArtistsWindowQuery(mTracksDatabase),
+          mSelectArtistsCountQuery(mTracksDatabase), mSelectAlbumIdFromTitleAndArtistQuery(mTracksDatabase),
+          mSelectMatchingAlbumsWindowQuery(mTracksDatabase), mSelectMatchingAlbumsCountQuery(mTracksDatabase),
+          mSelectArtistAlbumsQuery(mTracksDatabase), mSelectTracksFromIdsQuery(mTracksDatabase),
+          mSelectTracksKeyFromIdsQuery(mTracksDatabase), mSelectTracksKeyFromAlbumsTitleQuery(mTracksDatabase)
     {
     }
 
@@ -111,6 +146,8 @@ public:
 
     QSqlQuery mSelectAllTracksFromSourceQuery;
 
+    QSqlQuery mSelectAllTrackFilesFromSourceQuery;
+
     QSqlQuery mInsertMusicSource;
 
     QSqlQuery mSelectMusicSource;
@@ -125,7 +162,69 @@ public:
 
     QSqlQuery mSelectTracksMapping;
 
-    QSqlQuery mSelectTracksMappingPriority;
+    QSqlQuery mSelectTracksMappingFromFileNamesQuery;
+
+    QSqlQuery mInsertTracksBatchQuery;
+
+    QSqlQuery mInsertTracksMappingBatchQuery;
+
+    static const int mInsertTracksBatchSize = 100;
+
+    QSqlQuery mSelectArtistsPageQuery;
+
+    QSqlQuery mSelectAlbumsPageQuery;
+
+    QSqlQuery mSelectTracksIdPageQuery;
+
+    QSqlQuery mSearchLibraryQuery;
+
+    QSqlQuery mSelectAlbumsWindowQuery;
+
+    QSqlQuery mSelectAlbumsCountQuery;
+
+    QSqlQuery mSelectArtistsWindowQuery;
+
+    QSqlQuery mSelectArtistsCountQuery;
+
+    QSqlQuery mSelectAlbumIdFromTitleAndArtistQuery;
+
+    QSqlQuery mSelectMatchingAlbumsWindowQuery;
+
+    QSqlQuery mSelectMatchingAlbumsCountQuery;
+
+    QSqlQuery mSelectArtistAlbumsQuery;
+
+    QSqlQuery mSelectTracksFromIdsQuery;
+
+    QSqlQuery mSelectTracksKeyFromIdsQuery;
+
+    QSqlQuery mSelectTracksKeyFromAlbumsTitleQuery;
+
+    static const int mSelectTracksFromIdsBatchSize = 100;
+
+    QHash<QString, qulonglong> mBatchArtistIds;
+
+    QHash<QPair<QString, QString>, qulonglong> mBatchAlbumIds;
+
+    QVector<PendingTrackInsert> mPendingTracks;
+
+    QHash<QPair<QString, QPair<qulonglong, qulonglong>>, int> mPendingTracksIndex;
+
+    QList<qulonglong> mPendingAddedArtistIds;
+
+    QList<qulonglong> mPendingAddedAlbumIds;
+
+    QList<qulonglong> mPendingAddedTrackIds;
+
+    QSet<qulonglong> mPendingModifiedAlbumIds;
+
+    QSet<qulonglong> mPendingModifiedTrackIds;
+
+    QList<MusicArtist> mPendingRemovedArtists;
+
+    QList<MusicAlbum> mPendingRemovedAlbums;
+
+    QList<MusicAudioTrack> mPendingRemovedTracks;
 
     qulonglong mAlbumId = 1;
 
@@ -137,10 +236,224 @@ public:
 
     bool mInitFinished = false;
 
+    bool mHasSearchIndex = false;
+
+    int mRestoreBatchSize = 500;
+
     QAtomicInt mStopRequest = 0;
 
 };
 
+static QString insertTracksBatchQueryText(int rowsCount)
+{
+    auto queryText = QStringLiteral("INSERT INTO `Tracks` (`ID`, `Title`, `AlbumID`, `ArtistID`, `TrackNumber`, `DiscNumber`, `Duration`, `Rating`, `SortKey`) "
+                                    "VALUES ");
+
+    for (int i = 0; i < rowsCount; ++i) {
+        if (i > 0) {
+            queryText += QStringLiteral(", ");
+        }
+        queryText += QStringLiteral("(?, ?, ?, ?, ?, ?, ?, ?, ?)");
+    }
+
+    return queryText;
+}
+
+static QString insertTracksMappingBatchQueryText(int rowsCount)
+{
+    auto queryText = QStringLiteral("INSERT INTO `TracksMapping` (`FileName`, `DiscoverID`, `Priority`, `TrackValid`, `TrackID`, `FileSize`, `FileModifiedTime`) "
+                                    "VALUES ");
+
+    for (int i = 0; i < rowsCount; ++i) {
+        if (i > 0) {
+            queryText += QStringLiteral(", ");
+        }
+        queryText += QStringLiteral("(?, ?, (SELECT count(*) FROM `TracksMapping` otherMapping WHERE otherMapping.`TrackID` = ?) + ?, 1, ?, ?, ?)");
+    }
+
+    return queryText;
+}
+
+static QString idsPlaceholdersText(int idsCount)
+{
+    auto placeholdersText = QString();
+    placeholdersText.reserve(idsCount * 3);
+
+    for (int i = 0; i < idsCount; ++i) {
+        if (i > 0) {
+            placeholdersText += QStringLiteral(", ");
+        }
+        placeholdersText += QLatin1Char('?');
+    }
+
+    return placeholdersText;
+}
+
+static QString selectTracksFromIdsQueryText(int idsCount)
+{
+    return QStringLiteral("SELECT "
+                          "tracks.`Id`, "
+                          "tracks.`Title`, "
+                          "album.`Title`, "
+                          "artist.`Name`, "
+                          "artistAlbum.`Name`, "
+                          "tracksMapping.`FileName`, "
+                          "tracks.`TrackNumber`, "
+                          "tracks.`DiscNumber`, "
+                          "tracks.`Duration`, "
+                          "tracks.`Rating`, "
+                          "album.`CoverFileName` "
+                          "FROM `Tracks` tracks, `Artists` artist, `Artists` artistAlbum, `Albums` album, `TracksMapping` tracksMapping "
+                          "WHERE "
+                          "tracks.`ID` IN (%1) AND "
+                          "artist.`ID` = tracks.`ArtistID` AND "
+                          "artistAlbum.`ID` = album.`ArtistID` AND "
+                          "tracks.`AlbumID` = album.`ID` AND "
+                          "tracksMapping.`TrackID` = tracks.`ID` AND "
+                          "tracksMapping.`Priority` = 1").arg(idsPlaceholdersText(idsCount));
+}
+
+static QString selectTracksKeyFromIdsQueryText(int idsCount)
+{
+    return QStringLiteral("SELECT "
+                          "tracks.`Id`, "
+                          "tracks.`Title`, "
+                          "artist.`Name`, "
+                          "album.`Title` "
+                          "FROM `Tracks` tracks, `Artists` artist, `Albums` album "
+                          "WHERE "
+                          "tracks.`ID` IN (%1) AND "
+                          "artist.`ID` = tracks.`ArtistID` AND "
+                          "tracks.`AlbumID` = album.`ID`").arg(idsPlaceholdersText(idsCount));
+}
+
+static QString selectTracksKeyFromAlbumsTitleQueryText(int titlesCount)
+{
+    return QStringLiteral("SELECT "
+                          "tracks.`ID`, "
+                          "tracks.`Title`, "
+                          "album.`Title`, "
+                          "artist.`Name` "
+                          "FROM `Tracks` tracks, `Albums` album, `Artists` artist "
+                          "WHERE "
+                          "album.`Title` IN (%1) AND "
+                          "tracks.`AlbumID` = album.`ID` AND "
+                          "artist.`ID` = tracks.`ArtistID`").arg(idsPlaceholdersText(titlesCount));
+}
+
+static QString selectTracksMappingFromFileNamesQueryText(int fileNamesCount)
+{
+    return QStringLiteral("SELECT `FileName`, `TrackID` "
+                          "FROM `TracksMapping` "
+                          "WHERE `FileName` IN (%1)").arg(idsPlaceholdersText(fileNamesCount));
+}
+
+template <typename Value>
+static QList<QSqlRecord> recordsFromValues(QSqlDatabase &database, QSqlQuery &batchQuery, QString (*batchQueryText)(int),
+                                           int batchSize, const QList<Value> &values)
+{
+    auto result = QList<QSqlRecord>();
+    result.reserve(values.size());
+
+    for (int batchStart = 0; batchStart < values.size(); batchStart += batchSize) {
+        const auto batchValues = values.mid(batchStart, batchSize);
+
+        QSqlQuery partialBatchQuery(database);
+        auto *selectQuery = &batchQuery;
+
+        if (batchValues.size() != batchSize) {
+            partialBatchQuery.prepare(batchQueryText(batchValues.size()));
+            selectQuery = &partialBatchQuery;
+        }
+
+        for (int valueIndex = 0; valueIndex < batchValues.size(); ++valueIndex) {
+            selectQuery->bindValue(valueIndex, QVariant::fromValue(batchValues[valueIndex]));
+        }
+
+        auto queryResult = selectQuery->exec();
+
+        if (!queryResult || !selectQuery->isSelect() || !selectQuery->isActive()) {
+            qDebug() << "DatabaseInterface::recordsFromValues" << selectQuery->lastQuery();
+            qDebug() << "DatabaseInterface::recordsFromValues" << selectQuery->boundValues();
+            qDebug() << "DatabaseInterface::recordsFromValues" << selectQuery->lastError();
+
+            selectQuery->finish();
+
+            continue;
+        }
+
+        while (selectQuery->next()) {
+            result.push_back(selectQuery->record());
+        }
+
+        selectQuery->finish();
+    }
+
+    return result;
+}
+
+static QString sortKeyFromText(const QString &text)
+{
+    static const int numberWidth = 10;
+
+    auto sortText = text.trimmed();
+
+    if (sortText.size() > 4 && sortText.startsWith(QStringLiteral("the "), Qt::CaseInsensitive)) {
+        sortText = sortText.mid(4);
+    }
+
+    const auto decomposedText = sortText.normalized(QString::NormalizationForm_KD);
+
+    auto result = QString();
+    result.reserve(decomposedText.size() + numberWidth);
+
+    auto numberStart = -1;
+    auto pendingSpace = false;
+
+    for (const auto oneCharacter : decomposedText) {
+        if (oneCharacter.isMark()) {
+            continue;
+        }
+
+        if (oneCharacter.isDigit()) {
+            if (numberStart == -1) {
+                if (pendingSpace && !result.isEmpty()) {
+                    result += QLatin1Char(' ');
+                }
+                pendingSpace = false;
+                numberStart = result.size();
+            }
+
+            result += QLatin1Char(static_cast<char>('0' + oneCharacter.digitValue()));
+            continue;
+        }
+
+        if (numberStart != -1) {
+            if (result.size() - numberStart < numberWidth) {
+                result.insert(numberStart, QString(numberWidth - (result.size() - numberStart), QLatin1Char('0')));
+            }
+            numberStart = -1;
+        }
+
+        if (oneCharacter.isLetter()) {
+            if (pendingSpace && !result.isEmpty()) {
+                result += QLatin1Char(' ');
+            }
+            pendingSpace = false;
+
+            result += oneCharacter.toCaseFolded();
+        } else {
+            pendingSpace = true;
+        }
+    }
+
+    if (numberStart != -1 && result.size() - numberStart < numberWidth) {
+        result.insert(numberStart, QString(numberWidth - (result.size() - numberStart), QLatin1Char('0')));
+    }
+
+    return result;
+}
+
 DatabaseInterface::DatabaseInterface(QObject *parent) : QObject(parent), d(nullptr)
 {
 }
@@ -154,7 +467,7 @@ DatabaseInterface::~DatabaseInterface()
     delete d;
 }
 
-void DatabaseInterface::init(const QString &dbName, const QString &databaseFileName)
+void DatabaseInterface::init(const QString &dbName, const QString &databaseFileName, int restoreBatchSize)
 {
     QSqlDatabase tracksDatabase = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), dbName);
 
@@ -175,6 +488,10 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
 
     d = new DatabaseInterfacePrivate(tracksDatabase);
 
+    if (restoreBatchSize > 0) {
+        d->mRestoreBatchSize = restoreBatchSize;
+    }
+
     initDatabase();
     initRequest();
 
@@ -193,6 +510,9 @@ MusicAlbum DatabaseInterface::albumFromTitle(const QString &title)
     }
 
     result = internalAlbumFromTitle(title);
+    if (result.isValid()) {
+        result.setTracks(fetchTracks(result.databaseId()));
+    }
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
@@ -311,6 +631,54 @@ QList<MusicAudioTrack> DatabaseInterface::allTracksFromSource(const QString &mus
     return result;
 }
 
+void DatabaseInterface::askRestoredTracks(const QString &musicSource)
+{
+    auto allFiles = QHash<QUrl, QPair<qint64, QDateTime>>();
+
+    if (!d) {
+        Q_EMIT restoredTracks(musicSource, allFiles);
+        return;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        Q_EMIT restoredTracks(musicSource, allFiles);
+        return;
+    }
+
+    d->mSelectAllTrackFilesFromSourceQuery.bindValue(QStringLiteral(":source"), musicSource);
+
+    auto queryResult = d->mSelectAllTrackFilesFromSourceQuery.exec();
+
+    if (!queryResult || !d->mSelectAllTrackFilesFromSourceQuery.isSelect() || !d->mSelectAllTrackFilesFromSourceQuery.isActive()) {
+        qDebug() << "DatabaseInterface::askRestoredTracks" << d->mSelectAllTrackFilesFromSourceQuery.lastQuery();
+        qDebug() << "DatabaseInterface::askRestoredTracks" << d->mSelectAllTrackFilesFromSourceQuery.boundValues();
+        qDebug() << "DatabaseInterface::askRestoredTracks" << d->mSelectAllTrackFilesFromSourceQuery.lastError();
+
+        d->mSelectAllTrackFilesFromSourceQuery.finish();
+
+        rollBackTransaction();
+        Q_EMIT restoredTracks(musicSource, allFiles);
+        return;
+    }
+
+    while(d->mSelectAllTrackFilesFromSourceQuery.next()) {
+        const auto &currentRecord = d->mSelectAllTrackFilesFromSourceQuery.record();
+
+        const auto fileSize = currentRecord.isNull(1) ? qint64(-1) : currentRecord.value(1).toLongLong();
+
+        const auto fileModifiedTime = currentRecord.isNull(2) ? QDateTime() : QDateTime::fromMSecsSinceEpoch(currentRecord.value(2).toLongLong());
+
+        allFiles[currentRecord.value(0).toUrl()] = {fileSize, fileModifiedTime};
+    }
+
+    d->mSelectAllTrackFilesFromSourceQuery.finish();
+
+    finishTransaction();
+
+    Q_EMIT restoredTracks(musicSource, allFiles);
+}
+
 QList<MusicAudioTrack> DatabaseInterface::allInvalidTracksFromSource(const QString &musicSource) const
 {
     auto result = QList<MusicAudioTrack>();
@@ -387,27 +755,18 @@ QList<MusicAlbum> DatabaseInterface::allAlbums()
         qDebug() << "DatabaseInterface::allAlbums" << d->mSelectAllAlbumsQuery.boundValues();
         qDebug() << "DatabaseInterface::allAlbums" << d->mSelectAllAlbumsQuery.lastError();
 
-        return result;
-    }
-
-    while(d->mSelectAllAlbumsQuery.next()) {
-        auto newAlbum = MusicAlbum();
-
-        const auto &currentRecord = d->mSelectAllAlbumsQuery.record();
+        d->mSelectAllAlbumsQuery.finish();
 
-        newAlbum.setDatabaseId(currentRecord.value(0).toULongLong());
-        newAlbum.setTitle(currentRecord.value(1).toString());
-        newAlbum.setId(currentRecord.value(2).toString());
-        newAlbum.setArtist(currentRecord.value(3).toString());
-        newAlbum.setAlbumArtURI(currentRecord.value(4).toUrl());
-        newAlbum.setTracksCount(currentRecord.value(5).toInt());
-        newAlbum.setIsSingleDiscAlbum(currentRecord.value(6).toBool());
-        newAlbum.setTracks(fetchTracks(newAlbum.databaseId()));
-        newAlbum.setValid(true);
+        transactionResult = finishTransaction();
+        if (!transactionResult) {
+            return result;
+        }
 
-        result.push_back(newAlbum);
+        return result;
     }
 
+    result = internalAlbumsFromQuery(d->mSelectAllAlbumsQuery);
+
     d->mSelectAllAlbumsQuery.finish();
 
     transactionResult = finishTransaction();
@@ -592,11 +951,11 @@ MusicAudioTrack DatabaseInterface::trackFromDatabaseId(qulonglong id)
     return result;
 }
 
-qulonglong DatabaseInterface::trackIdFromTitleAlbumArtist(const QString &title, const QString &album, const QString &artist) const
+QList<MusicAudioTrack> DatabaseInterface::tracksFromDatabaseIds(const QList<qulonglong> &ids)
 {
-    auto result = qulonglong(0);
+    auto result = QList<MusicAudioTrack>();
 
-    if (!d) {
+    if (!d || !d->mTracksDatabase.isValid() || !d->mInitFinished || ids.isEmpty()) {
         return result;
     }
 
@@ -605,7 +964,29 @@ qulonglong DatabaseInterface::trackIdFromTitleAlbumArtist(const QString &title,
         return result;
     }
 
-    result = internalTrackIdFromTitleAlbumArtist(title, album, artist);
+    const auto allRecords = recordsFromValues(d->mTracksDatabase, d->mSelectTracksFromIdsQuery, selectTracksFromIdsQueryText,
+                                              d->mSelectTracksFromIdsBatchSize, ids);
+
+    result.reserve(allRecords.size());
+
+    for (const auto &currentRecord : allRecords) {
+        auto newTrack = MusicAudioTrack();
+
+        newTrack.setDatabaseId(currentRecord.value(0).toULongLong());
+        newTrack.setTitle(currentRecord.value(1).toString());
+        newTrack.setAlbumName(currentRecord.value(2).toString());
+        newTrack.setArtist(currentRecord.value(3).toString());
+        newTrack.setAlbumArtist(currentRecord.value(4).toString());
+        newTrack.setResourceURI(currentRecord.value(5).toUrl());
+        newTrack.setTrackNumber(currentRecord.value(6).toInt());
+        newTrack.setDiscNumber(currentRecord.value(7).toInt());
+        newTrack.setDuration(QTime::fromMSecsSinceStartOfDay(currentRecord.value(8).toLongLong()));
+        newTrack.setRating(currentRecord.value(9).toInt());
+        newTrack.setAlbumCover(currentRecord.value(10).toUrl());
+        newTrack.setValid(true);
+
+        result.push_back(newTrack);
+    }
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
@@ -615,84 +996,432 @@ qulonglong DatabaseInterface::trackIdFromTitleAlbumArtist(const QString &title,
     return result;
 }
 
-void DatabaseInterface::applicationAboutToQuit()
+QList<MusicAudioTrack> DatabaseInterface::tracksKeyFromDatabaseIds(const QList<qulonglong> &ids)
 {
-    d->mStopRequest = 1;
-}
+    auto result = QList<MusicAudioTrack>();
+
+    if (!d || !d->mTracksDatabase.isValid() || !d->mInitFinished || ids.isEmpty()) {
+        return result;
+    }
 
-void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource)
-{
     auto transactionResult = startTransaction();
     if (!transactionResult) {
-        return;
+        return result;
     }
 
-    QSet<qulonglong> modifiedAlbumIds;
-
-    for(const auto &oneTrack : tracks) {
-        d->mSelectTracksMapping.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
-
-        auto result = d->mSelectTracksMapping.exec();
+    const auto allRecords = recordsFromValues(d->mTracksDatabase, d->mSelectTracksKeyFromIdsQuery, selectTracksKeyFromIdsQueryText,
+                                              d->mSelectTracksFromIdsBatchSize, ids);
 
-        if (!result || !d->mSelectTracksMapping.isSelect() || !d->mSelectTracksMapping.isActive()) {
-            qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastQuery();
-            qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.boundValues();
-            qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastError();
+    result.reserve(allRecords.size());
 
-            d->mSelectTracksMapping.finish();
+    // only the id, title, artist and album name are read
+    for (const auto &currentRecord : allRecords) {
+        auto newTrack = MusicAudioTrack();
 
-            rollBackTransaction();
-            return;
-        }
+        newTrack.setDatabaseId(currentRecord.value(0).toULongLong());
+        newTrack.setTitle(currentRecord.value(1).toString());
+        newTrack.setArtist(currentRecord.value(2).toString());
+        newTrack.setAlbumName(currentRecord.value(3).toString());
 
-        bool isNewTrack = !d->mSelectTracksMapping.next();
+        result.push_back(newTrack);
+    }
 
-        if (isNewTrack) {
-            insertTrackOrigin(oneTrack.resourceURI(), insertMusicSource(musicSource));
-        } else {
-            updateTrackOrigin(d->mSelectTracksMapping.record().value(0).toULongLong(), oneTrack.resourceURI());
-        }
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
 
-        d->mSelectTracksMapping.finish();
+    return result;
+}
 
-        internalInsertTrack(oneTrack, covers, 0, modifiedAlbumIds);
+QList<MusicAudioTrack> DatabaseInterface::tracksFromAlbumId(qulonglong albumId)
+{
+    auto result = QList<MusicAudioTrack>();
 
-        if (d->mStopRequest == 1) {
-            transactionResult = finishTransaction();
-            if (!transactionResult) {
-                return;
-            }
-            return;
-        }
+    if (!d) {
+        return result;
     }
 
-    const auto &constModifiedAlbumIds = modifiedAlbumIds;
-    for (auto albumId : constModifiedAlbumIds) {
-        Q_EMIT albumModified(internalAlbumFromId(albumId));
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
     }
 
+    result = fetchTracks(albumId);
+
     transactionResult = finishTransaction();
     if (!transactionResult) {
-        return;
+        return result;
     }
+
+    return result;
 }
 
-void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
+void DatabaseInterface::searchLibrary(const QString &searchText)
 {
-    auto transactionResult = startTransaction();
-    if (!transactionResult) {
+    auto albumIds = QList<qulonglong>();
+    auto trackIds = QList<qulonglong>();
+
+    if (!d) {
+        Q_EMIT librarySearchResult(searchText, albumIds, trackIds);
         return;
     }
 
-    QList<MusicAudioTrack> willRemoveTrack;
+    const auto matchExpression = searchMatchExpression(searchText);
 
-    for (const auto &removedTrackFileName : removedTracks) {
-        d->mSelectTrackFromFilePathQuery.bindValue(QStringLiteral(":filePath"), removedTrackFileName.toString());
+    if (matchExpression.isEmpty()) {
+        Q_EMIT librarySearchResult(searchText, albumIds, trackIds);
+        return;
+    }
 
-        auto result = d->mSelectTrackFromFilePathQuery.exec();
+    d->mSearchLibraryQuery.bindValue(QStringLiteral(":searchText"), matchExpression);
 
-        if (!result || !d->mSelectTrackFromFilePathQuery.isSelect() || !d->mSelectTrackFromFilePathQuery.isActive()) {
-            qDebug() << "DatabaseInterface::removeTracksList" << d->mSelectTrackFromFilePathQuery.lastQuery();
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        Q_EMIT librarySearchResult(searchText, albumIds, trackIds);
+        return;
+    }
+
+    auto queryResult = d->mSearchLibraryQuery.exec();
+
+    if (!queryResult || !d->mSearchLibraryQuery.isSelect() || !d->mSearchLibraryQuery.isActive()) {
+        qDebug() << "DatabaseInterface::searchLibrary" << d->mSearchLibraryQuery.lastQuery();
+        qDebug() << "DatabaseInterface::searchLibrary" << d->mSearchLibraryQuery.boundValues();
+        qDebug() << "DatabaseInterface::searchLibrary" << d->mSearchLibraryQuery.lastError();
+
+        d->mSearchLibraryQuery.finish();
+
+        finishTransaction();
+
+        Q_EMIT librarySearchResult(searchText, albumIds, trackIds);
+        return;
+    }
+
+    auto matchedAlbumIds = QSet<qulonglong>();
+
+    while (d->mSearchLibraryQuery.next()) {
+        const auto &currentRecord = d->mSearchLibraryQuery.record();
+
+        trackIds.push_back(currentRecord.value(0).toULongLong());
+
+        const auto albumId = currentRecord.value(1).toULongLong();
+        if (!matchedAlbumIds.contains(albumId)) {
+            matchedAlbumIds.insert(albumId);
+            albumIds.push_back(albumId);
+        }
+    }
+
+    d->mSearchLibraryQuery.finish();
+
+    finishTransaction();
+
+    Q_EMIT librarySearchResult(searchText, albumIds, trackIds);
+}
+
+void DatabaseInterface::fetchAlbumsWindow(const QString &filterText, int filterRating, int offset, int count)
+{
+    auto albums = QList<MusicAlbum>();
+    auto albumsCount = 0;
+
+    if (!d) {
+        Q_EMIT albumsWindow(filterText, filterRating, albumsCount, offset, albums);
+        return;
+    }
+
+    const auto matchExpression = searchMatchExpression(filterText);
+    const auto hasMatchExpression = !matchExpression.isEmpty();
+
+    auto &countQuery = (hasMatchExpression ? d->mSelectMatchingAlbumsCountQuery : d->mSelectAlbumsCountQuery);
+    auto &windowQuery = (hasMatchExpression ? d->mSelectMatchingAlbumsWindowQuery : d->mSelectAlbumsWindowQuery);
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        Q_EMIT albumsWindow(filterText, filterRating, -1, offset, albums);
+        return;
+    }
+
+    if (hasMatchExpression) {
+        countQuery.bindValue(QStringLiteral(":searchText"), matchExpression);
+        windowQuery.bindValue(QStringLiteral(":searchText"), matchExpression);
+    }
+
+    countQuery.bindValue(QStringLiteral(":minimumRating"), filterRating);
+    windowQuery.bindValue(QStringLiteral(":minimumRating"), filterRating);
+
+    albumsCount = internalEntitiesCount(countQuery);
+
+    if (albumsCount < 0) {
+        finishTransaction();
+
+        Q_EMIT albumsWindow(filterText, filterRating, albumsCount, offset, albums);
+        return;
+    }
+
+    windowQuery.bindValue(QStringLiteral(":windowSize"), count);
+    windowQuery.bindValue(QStringLiteral(":windowOffset"), offset);
+
+    auto queryResult = windowQuery.exec();
+
+    if (!queryResult || !windowQuery.isSelect() || !windowQuery.isActive()) {
+        qDebug() << "DatabaseInterface::fetchAlbumsWindow" << windowQuery.lastQuery();
+        qDebug() << "DatabaseInterface::fetchAlbumsWindow" << windowQuery.boundValues();
+        qDebug() << "DatabaseInterface::fetchAlbumsWindow" << windowQuery.lastError();
+
+        windowQuery.finish();
+
+        finishTransaction();
+
+        Q_EMIT albumsWindow(filterText, filterRating, -1, offset, albums);
+        return;
+    }
+
+    albums.reserve(count);
+
+    while (windowQuery.next()) {
+        albums.push_back(internalAlbumFromPageRecord(windowQuery.record()));
+    }
+
+    windowQuery.finish();
+
+    finishTransaction();
+
+    Q_EMIT albumsWindow(filterText, filterRating, albumsCount, offset, albums);
+}
+
+void DatabaseInterface::fetchAlbumTracks(qulonglong albumId)
+{
+    if (!d) {
+        return;
+    }
+
+    Q_EMIT albumTracks(albumId, tracksFromAlbumId(albumId));
+}
+
+void DatabaseInterface::fetchArtistAlbums(qulonglong artistId)
+{
+    auto albums = QList<MusicAlbum>();
+
+    if (!d) {
+        Q_EMIT artistAlbums(artistId, albums);
+        return;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        Q_EMIT artistAlbums(artistId, albums);
+        return;
+    }
+
+    d->mSelectArtistAlbumsQuery.bindValue(QStringLiteral(":artistId"), artistId);
+
+    auto queryResult = d->mSelectArtistAlbumsQuery.exec();
+
+    if (!queryResult || !d->mSelectArtistAlbumsQuery.isSelect() || !d->mSelectArtistAlbumsQuery.isActive()) {
+        qDebug() << "DatabaseInterface::fetchArtistAlbums" << d->mSelectArtistAlbumsQuery.lastQuery();
+        qDebug() << "DatabaseInterface::fetchArtistAlbums" << d->mSelectArtistAlbumsQuery.boundValues();
+        qDebug() << "DatabaseInterface::fetchArtistAlbums" << d->mSelectArtistAlbumsQuery.lastError();
+    }
+
+    while (d->mSelectArtistAlbumsQuery.next()) {
+        albums.push_back(internalAlbumFromPageRecord(d->mSelectArtistAlbumsQuery.record()));
+    }
+
+    d->mSelectArtistAlbumsQuery.finish();
+
+    finishTransaction();
+
+    Q_EMIT artistAlbums(artistId, albums);
+}
+
+void DatabaseInterface::fetchArtistsWindow(int offset, int count)
+{
+    auto artists = QList<MusicArtist>();
+
+    if (!d) {
+        Q_EMIT artistsWindow(0, offset, artists);
+        return;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        Q_EMIT artistsWindow(-1, offset, artists);
+        return;
+    }
+
+    const auto artistsCount = internalEntitiesCount(d->mSelectArtistsCountQuery);
+
+    if (artistsCount < 0) {
+        finishTransaction();
+
+        Q_EMIT artistsWindow(artistsCount, offset, artists);
+        return;
+    }
+
+    d->mSelectArtistsWindowQuery.bindValue(QStringLiteral(":windowSize"), count);
+    d->mSelectArtistsWindowQuery.bindValue(QStringLiteral(":windowOffset"), offset);
+
+    auto queryResult = d->mSelectArtistsWindowQuery.exec();
+
+    if (!queryResult || !d->mSelectArtistsWindowQuery.isSelect() || !d->mSelectArtistsWindowQuery.isActive()) {
+        qDebug() << "DatabaseInterface::fetchArtistsWindow" << d->mSelectArtistsWindowQuery.lastQuery();
+        qDebug() << "DatabaseInterface::fetchArtistsWindow" << d->mSelectArtistsWindowQuery.boundValues();
+        qDebug() << "DatabaseInterface::fetchArtistsWindow" << d->mSelectArtistsWindowQuery.lastError();
+
+        d->mSelectArtistsWindowQuery.finish();
+
+        finishTransaction();
+
+        Q_EMIT artistsWindow(-1, offset, artists);
+        return;
+    }
+
+    artists.reserve(count);
+
+    while (d->mSelectArtistsWindowQuery.next()) {
+        auto newArtist = MusicArtist();
+
+        const auto &currentRecord = d->mSelectArtistsWindowQuery.record();
+
+        newArtist.setDatabaseId(currentRecord.value(0).toULongLong());
+        newArtist.setName(currentRecord.value(1).toString());
+        newArtist.setAlbumsCount(currentRecord.value(2).toInt());
+        newArtist.setValid(true);
+
+        artists.push_back(newArtist);
+    }
+
+    d->mSelectArtistsWindowQuery.finish();
+
+    finishTransaction();
+
+    Q_EMIT artistsWindow(artistsCount, offset, artists);
+}
+
+qulonglong DatabaseInterface::trackIdFromTitleAlbumArtist(const QString &title, const QString &album, const QString &artist) const
+{
+    auto result = qulonglong(0);
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result = internalTrackIdFromTitleAlbumArtist(title, album, artist);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+void DatabaseInterface::applicationAboutToQuit()
+{
+    d->mStopRequest = 1;
+}
+
+void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    QSet<qulonglong> modifiedAlbumIds;
+    QSet<qulonglong> insertedAlbumIds;
+
+    auto discoverId = qulonglong(0);
+
+    for(const auto &oneTrack : tracks) {
+        if (discoverId == 0) {
+            discoverId = insertMusicSource(musicSource);
+        }
+
+        if (!oneTrack.albumArtist().isEmpty()) {
+            internalInsertTrack(oneTrack, covers, discoverId, insertedAlbumIds);
+
+            if (d->mPendingTracks.size() >= d->mInsertTracksBatchSize) {
+                flushPendingTracks(modifiedAlbumIds);
+            }
+        } else {
+            d->mSelectTracksMapping.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
+
+            auto result = d->mSelectTracksMapping.exec();
+
+            if (!result || !d->mSelectTracksMapping.isSelect() || !d->mSelectTracksMapping.isActive()) {
+                qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastQuery();
+                qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.boundValues();
+                qDebug() << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastError();
+
+                d->mSelectTracksMapping.finish();
+
+                clearInsertBatch();
+                clearChanges();
+                rollBackTransaction();
+                return;
+            }
+
+            bool isNewTrack = !d->mSelectTracksMapping.next();
+
+            if (isNewTrack) {
+                insertTrackOrigin(oneTrack.resourceURI(), oneTrack.fileSize(), oneTrack.fileModifiedTime(), discoverId);
+            } else {
+                updateTrackOrigin(d->mSelectTracksMapping.record().value(0).toULongLong(), oneTrack.resourceURI(),
+                                  oneTrack.fileSize(), oneTrack.fileModifiedTime());
+            }
+
+            d->mSelectTracksMapping.finish();
+        }
+
+        if (d->mStopRequest == 1) {
+            break;
+        }
+    }
+
+    flushPendingTracks(modifiedAlbumIds);
+
+    const auto &constInsertedAlbumIds = insertedAlbumIds;
+    for (auto albumId : constInsertedAlbumIds) {
+        updateIsSingleDiscAlbumFromId(albumId);
+        if (updateTracksCount(albumId)) {
+            modifiedAlbumIds.insert(albumId);
+        }
+    }
+
+    d->mPendingModifiedAlbumIds.unite(modifiedAlbumIds);
+
+    clearInsertBatch();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        clearChanges();
+        return;
+    }
+
+    publishChanges();
+}
+
+void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    QList<MusicAudioTrack> willRemoveTrack;
+
+    for (const auto &removedTrackFileName : removedTracks) {
+        d->mSelectTrackFromFilePathQuery.bindValue(QStringLiteral(":filePath"), removedTrackFileName.toString());
+
+        auto result = d->mSelectTrackFromFilePathQuery.exec();
+
+        if (!result || !d->mSelectTrackFromFilePathQuery.isSelect() || !d->mSelectTrackFromFilePathQuery.isActive()) {
+            qDebug() << "DatabaseInterface::removeTracksList" << d->mSelectTrackFromFilePathQuery.lastQuery();
             qDebug() << "DatabaseInterface::removeTracksList" << d->mSelectTrackFromFilePathQuery.boundValues();
             qDebug() << "DatabaseInterface::removeTracksList" << d->mSelectTrackFromFilePathQuery.lastError();
 
@@ -727,12 +1456,11 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
 
     for (const auto &oneRemovedTrack : willRemoveTrack) {
         removeTrackInDatabase(oneRemovedTrack.databaseId());
-        Q_EMIT trackRemoved(oneRemovedTrack.databaseId());
+        d->mPendingRemovedTracks.push_back(oneRemovedTrack);
 
-        const auto &modifiedAlbumId = internalAlbumIdFromTitle(oneRemovedTrack.albumName());
+        const auto &modifiedAlbumId = oneRemovedTrack.parentId().toULongLong();
         const auto &allArtistTracks = internalTracksFromAuthor(oneRemovedTrack.artist());
         const auto &removedArtistId = internalArtistIdFromName(oneRemovedTrack.artist());
-        const auto &removedArtist = internalArtistFromId(removedArtistId);
 
         if (updateTracksCount(modifiedAlbumId)) {
             modifiedAlbums.insert(modifiedAlbumId);
@@ -740,26 +1468,29 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
         updateIsSingleDiscAlbumFromId(modifiedAlbumId);
 
         if (allArtistTracks.isEmpty()) {
+            d->mPendingRemovedArtists.push_back(internalArtistFromId(removedArtistId));
             removeArtistInDatabase(removedArtistId);
-            Q_EMIT artistRemoved(removedArtist);
         }
     }
 
     for (auto modifiedAlbumId : modifiedAlbums) {
-        auto modifiedAlbum = internalAlbumFromId(modifiedAlbumId);
+        auto modifiedAlbum = internalAlbumWithTracksFromId(modifiedAlbumId);
 
         if (modifiedAlbum.isValid() && !modifiedAlbum.isEmpty()) {
-            Q_EMIT albumModified(modifiedAlbum);
+            d->mPendingModifiedAlbumIds.insert(modifiedAlbumId);
         } else {
             removeAlbumInDatabase(modifiedAlbum.databaseId());
-            Q_EMIT albumRemoved(modifiedAlbum);
+            d->mPendingRemovedAlbums.push_back(modifiedAlbum);
         }
     }
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
+        clearChanges();
         return;
     }
+
+    publishChanges();
 }
 
 void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers)
@@ -797,7 +1528,7 @@ void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedT
 
             const auto oldTrack = internalTrackFromDatabaseId(originTrackId);
             if (oldTrack == oneModifiedTrack) {
-                updateTrackOrigin(originTrackId, oneModifiedTrack.resourceURI());
+                updateTrackOrigin(originTrackId, oneModifiedTrack.resourceURI(), oneModifiedTrack.fileSize(), oneModifiedTrack.fileModifiedTime());
                 continue;
             }
 
@@ -814,6 +1545,7 @@ void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedT
         d->mInsertTrackQuery.bindValue(QStringLiteral(":discNumber"), oneModifiedTrack.discNumber());
         d->mInsertTrackQuery.bindValue(QStringLiteral(":trackDuration"), QVariant::fromValue<qlonglong>(oneModifiedTrack.duration().msecsSinceStartOfDay()));
         d->mInsertTrackQuery.bindValue(QStringLiteral(":trackRating"), oneModifiedTrack.rating());
+        d->mInsertTrackQuery.bindValue(QStringLiteral(":sortKey"), sortKeyFromText(oneModifiedTrack.title()));
 
         auto result = d->mInsertTrackQuery.exec();
 
@@ -824,18 +1556,18 @@ void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedT
                 ++d->mTrackId;
             }
 
-            updateTrackOrigin(originTrackId, oneModifiedTrack.resourceURI());
+            updateTrackOrigin(originTrackId, oneModifiedTrack.resourceURI(), oneModifiedTrack.fileSize(), oneModifiedTrack.fileModifiedTime());
 
             if (originTrack.isValid() || otherTrackId != 0) {
-                Q_EMIT trackModified(originTrackId);
-                Q_EMIT albumModified(internalAlbumFromId(albumId));
+                d->mPendingModifiedTrackIds.insert(originTrackId);
+                d->mPendingModifiedAlbumIds.insert(albumId);
             } else {
-                Q_EMIT trackAdded(originTrackId);
+                d->mPendingAddedTrackIds.push_back(originTrackId);
             }
 
             updateIsSingleDiscAlbumFromId(albumId);
             if (updateTracksCount(albumId)) {
-                Q_EMIT albumModified(internalAlbumFromId(albumId));
+                d->mPendingModifiedAlbumIds.insert(albumId);
             }
         } else {
             d->mInsertTrackQuery.finish();
@@ -850,8 +1582,11 @@ void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedT
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
+        clearChanges();
         return;
     }
+
+    publishChanges();
 }
 
 bool DatabaseInterface::startTransaction() const
@@ -930,12 +1665,15 @@ void DatabaseInterface::initDatabase() const
 
         const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `Artists` (`ID` INTEGER PRIMARY KEY NOT NULL, "
                                                                    "`Name` VARCHAR(55) NOT NULL, "
+                                                                   "`SortKey` VARCHAR(55) NOT NULL DEFAULT '', "
                                                                    "UNIQUE (`Name`))"));
 
         if (!result) {
             qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastQuery();
             qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
         }
+    } else {
+        initSortKeys(QStringLiteral("Artists"), QStringLiteral("Name"));
     }
 
     if (!listTables.contains(QStringLiteral("Albums"))) {
@@ -949,12 +1687,15 @@ void DatabaseInterface::initDatabase() const
                                                                    "`TracksCount` INTEGER NOT NULL, "
                                                                    "`IsSingleDiscAlbum` BOOLEAN NOT NULL, "
                                                                    "`AlbumInternalID` VARCHAR(55), "
+                                                                   "`SortKey` VARCHAR(55) NOT NULL DEFAULT '', "
                                                                    "UNIQUE (`Title`, `ArtistID`), "
                                                                    "CONSTRAINT fk_albums_artist FOREIGN KEY (`ArtistID`) REFERENCES `Artists`(`ID`))"));
 
         if (!result) {
             qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
         }
+    } else {
+        initSortKeys(QStringLiteral("Albums"), QStringLiteral("Title"));
     }
 
     if (!listTables.contains(QStringLiteral("Tracks"))) {
@@ -969,6 +1710,7 @@ void DatabaseInterface::initDatabase() const
                                                                    "`DiscNumber` INTEGER, "
                                                                    "`Duration` INTEGER NOT NULL, "
                                                                    "`Rating` INTEGER NOT NULL DEFAULT 0, "
+                                                                   "`SortKey` VARCHAR(85) NOT NULL DEFAULT '', "
                                                                    "UNIQUE (`Title`, `AlbumID`, `ArtistID`), "
                                                                    "CONSTRAINT fk_tracks_album FOREIGN KEY (`AlbumID`) REFERENCES `Albums`(`ID`), "
                                                                    "CONSTRAINT fk_tracks_artist FOREIGN KEY (`ArtistID`) REFERENCES `Artists`(`ID`))"));
@@ -976,143 +1718,630 @@ void DatabaseInterface::initDatabase() const
         if (!result) {
             qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
         }
-    } else {
-        auto listColumns = d->mTracksDatabase.record(QStringLiteral("Tracks"));
+    } else {
+        auto listColumns = d->mTracksDatabase.record(QStringLiteral("Tracks"));
+
+        if (!listColumns.contains(QStringLiteral("Rating"))) {
+            QSqlQuery alterSchemaQuery(d->mTracksDatabase);
+
+            const auto &result = alterSchemaQuery.exec(QStringLiteral("ALTER TABLE `Tracks` "
+                                                                       "ADD COLUMN RATING INTEGER NOT NULL DEFAULT 0"));
+
+            if (!result) {
+                qDebug() << "DatabaseInterface::initDatabase" << alterSchemaQuery.lastError();
+            }
+        }
+
+        initSortKeys(QStringLiteral("Tracks"), QStringLiteral("Title"));
+    }
+
+    if (!listTables.contains(QStringLiteral("TracksMapping"))) {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `TracksMapping` ("
+                                                                   "`TrackID` INTEGER NULL, "
+                                                                   "`DiscoverID` INTEGER NOT NULL, "
+                                                                   "`FileName` VARCHAR(255) NOT NULL, "
+                                                                   "`Priority` INTEGER NOT NULL, "
+                                                                   "`TrackValid` BOOLEAN NOT NULL, "
+                                                                   "`FileSize` INTEGER NULL, "
+                                                                   "`FileModifiedTime` INTEGER NULL, "
+                                                                   "PRIMARY KEY (`FileName`), "
+                                                                   "CONSTRAINT TracksUnique UNIQUE (`TrackID`, `Priority`), "
+                                                                   "CONSTRAINT fk_tracksmapping_trackID FOREIGN KEY (`TrackID`) REFERENCES `Tracks`(`ID`), "
+                                                                   "CONSTRAINT fk_tracksmapping_discoverID FOREIGN KEY (`DiscoverID`) REFERENCES `DiscoverSource`(`ID`))"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
+        }
+    } else {
+        auto listColumns = d->mTracksDatabase.record(QStringLiteral("TracksMapping"));
+
+        if (!listColumns.contains(QStringLiteral("FileSize"))) {
+            QSqlQuery alterSchemaQuery(d->mTracksDatabase);
+
+            const auto &result = alterSchemaQuery.exec(QStringLiteral("ALTER TABLE `TracksMapping` "
+                                                                       "ADD COLUMN `FileSize` INTEGER NULL"));
+
+            if (!result) {
+                qDebug() << "DatabaseInterface::initDatabase" << alterSchemaQuery.lastError();
+            }
+        }
+
+        if (!listColumns.contains(QStringLiteral("FileModifiedTime"))) {
+            QSqlQuery alterSchemaQuery(d->mTracksDatabase);
+
+            const auto &result = alterSchemaQuery.exec(QStringLiteral("ALTER TABLE `TracksMapping` "
+                                                                       "ADD COLUMN `FileModifiedTime` INTEGER NULL"));
+
+            if (!result) {
+                qDebug() << "DatabaseInterface::initDatabase" << alterSchemaQuery.lastError();
+            }
+        } else {
+            initFileModifiedTimes();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksAlbumIndex` ON `Tracks` "
+                                                                  "(`AlbumID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`AlbumsArtistIndex` ON `Albums` "
+                                                                  "(`ArtistID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksFileNameIndex` ON `TracksMapping` "
+                                                                  "(`FileName`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksArtistIDAlbumIDFileNameIndex` ON `Tracks` "
+                                                                  "(`ArtistID`, `AlbumID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createSortKeyIndex(d->mTracksDatabase);
+
+        const auto &result = createSortKeyIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                    "IF NOT EXISTS "
+                                                                    "`ArtistsSortKeyIndex` ON `Artists` "
+                                                                    "(`SortKey`, `ID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createSortKeyIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createSortKeyIndex(d->mTracksDatabase);
+
+        const auto &result = createSortKeyIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                    "IF NOT EXISTS "
+                                                                    "`AlbumsSortKeyIndex` ON `Albums` "
+                                                                    "(`SortKey`, `ID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createSortKeyIndex.lastError();
+        }
+    }
+
+    {
+        QSqlQuery createSortKeyIndex(d->mTracksDatabase);
+
+        const auto &result = createSortKeyIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                    "IF NOT EXISTS "
+                                                                    "`TracksSortKeyIndex` ON `Tracks` "
+                                                                    "(`SortKey`, `ID`)"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createSortKeyIndex.lastError();
+        }
+    }
+
+    initSearchIndex(listTables);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::initSortKeys(const QString &tableName, const QString &textColumnName) const
+{
+    const auto listColumns = d->mTracksDatabase.record(tableName);
+
+    if (listColumns.contains(QStringLiteral("SortKey"))) {
+        return;
+    }
+
+    QSqlQuery alterSchemaQuery(d->mTracksDatabase);
+
+    auto result = alterSchemaQuery.exec(QStringLiteral("ALTER TABLE `") + tableName + QStringLiteral("` "
+                                                       "ADD COLUMN `SortKey` VARCHAR(85) NOT NULL DEFAULT ''"));
+
+    if (!result) {
+        qDebug() << "DatabaseInterface::initSortKeys" << alterSchemaQuery.lastQuery();
+        qDebug() << "DatabaseInterface::initSortKeys" << alterSchemaQuery.lastError();
+
+        return;
+    }
+
+    QSqlQuery selectTextQuery(d->mTracksDatabase);
+
+    result = selectTextQuery.exec(QStringLiteral("SELECT `ID`, `") + textColumnName + QStringLiteral("` FROM `") + tableName + QStringLiteral("`"));
+
+    if (!result) {
+        qDebug() << "DatabaseInterface::initSortKeys" << selectTextQuery.lastQuery();
+        qDebug() << "DatabaseInterface::initSortKeys" << selectTextQuery.lastError();
+
+        return;
+    }
+
+    QSqlQuery updateSortKeyQuery(d->mTracksDatabase);
+
+    updateSortKeyQuery.prepare(QStringLiteral("UPDATE `") + tableName + QStringLiteral("` SET `SortKey` = :sortKey WHERE `ID` = :id"));
+
+    while (selectTextQuery.next()) {
+        const auto &currentRecord = selectTextQuery.record();
+
+        updateSortKeyQuery.bindValue(QStringLiteral(":sortKey"), sortKeyFromText(currentRecord.value(1).toString()));
+        updateSortKeyQuery.bindValue(QStringLiteral(":id"), currentRecord.value(0));
+
+        result = updateSortKeyQuery.exec();
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initSortKeys" << updateSortKeyQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initSortKeys" << updateSortKeyQuery.boundValues();
+            qDebug() << "DatabaseInterface::initSortKeys" << updateSortKeyQuery.lastError();
+        }
+
+        updateSortKeyQuery.finish();
+    }
+
+    selectTextQuery.finish();
+}
+
+void DatabaseInterface::initFileModifiedTimes() const
+{
+    QSqlQuery selectTextQuery(d->mTracksDatabase);
+
+    auto result = selectTextQuery.exec(QStringLiteral("SELECT `FileName`, `FileModifiedTime` "
+                                                      "FROM `TracksMapping` "
+                                                      "WHERE typeof(`FileModifiedTime`) = 'text'"));
+
+    if (!result) {
+        qDebug() << "DatabaseInterface::initFileModifiedTimes" << selectTextQuery.lastQuery();
+        qDebug() << "DatabaseInterface::initFileModifiedTimes" << selectTextQuery.lastError();
+
+        return;
+    }
+
+    QSqlQuery updateTimeQuery(d->mTracksDatabase);
+
+    updateTimeQuery.prepare(QStringLiteral("UPDATE `TracksMapping` SET `FileModifiedTime` = :fileModifiedTime WHERE `FileName` = :fileName"));
+
+    while (selectTextQuery.next()) {
+        const auto &currentRecord = selectTextQuery.record();
+
+        const auto fileModifiedTime = QDateTime::fromString(currentRecord.value(1).toString(), Qt::ISODate);
+
+        updateTimeQuery.bindValue(QStringLiteral(":fileModifiedTime"), (fileModifiedTime.isValid() ? QVariant::fromValue(fileModifiedTime.toMSecsSinceEpoch()) : QVariant()));
+        updateTimeQuery.bindValue(QStringLiteral(":fileName"), currentRecord.value(0));
+
+        result = updateTimeQuery.exec();
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initFileModifiedTimes" << updateTimeQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initFileModifiedTimes" << updateTimeQuery.boundValues();
+            qDebug() << "DatabaseInterface::initFileModifiedTimes" << updateTimeQuery.lastError();
+        }
+
+        updateTimeQuery.finish();
+    }
+
+    selectTextQuery.finish();
+}
+
+void DatabaseInterface::initSearchIndex(const QStringList &listTables) const
+{
+    const auto searchIndexExists = listTables.contains(QStringLiteral("SearchIndex"));
+
+    if (!searchIndexExists) {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE VIRTUAL TABLE `SearchIndex` USING fts5("
+                                                                   "`AlbumID` UNINDEXED, "
+                                                                   "`Title`, "
+                                                                   "`Artist`, "
+                                                                   "`AlbumTitle`, "
+                                                                   "`AlbumArtist`, "
+                                                                   "tokenize = 'unicode61 remove_diacritics 1', "
+                                                                   "prefix = '1 2 3')"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initSearchIndex" << "full text search is not available" << createSchemaQuery.lastError();
+
+            d->mHasSearchIndex = false;
+
+            return;
+        }
+    }
+
+    d->mHasSearchIndex = true;
+
+    const auto insertSearchEntryText = QStringLiteral("DELETE FROM `SearchIndex` WHERE rowid = new.`ID`; "
+                                                      "INSERT INTO `SearchIndex` (rowid, `AlbumID`, `Title`, `Artist`, `AlbumTitle`, `AlbumArtist`) "
+                                                      "SELECT new.`ID`, new.`AlbumID`, new.`Title`, trackArtist.`Name`, album.`Title`, albumArtist.`Name` "
+                                                      "FROM `Artists` trackArtist "
+                                                      "LEFT JOIN `Albums` album ON album.`ID` = new.`AlbumID` "
+                                                      "LEFT JOIN `Artists` albumArtist ON albumArtist.`ID` = album.`ArtistID` "
+                                                      "WHERE trackArtist.`ID` = new.`ArtistID`; ");
+
+    const auto allTriggers = QStringList{
+        QStringLiteral("CREATE TRIGGER IF NOT EXISTS `SearchIndexTrackInsert` AFTER INSERT ON `Tracks` BEGIN ") + insertSearchEntryText + QStringLiteral("END"),
+        QStringLiteral("CREATE TRIGGER IF NOT EXISTS `SearchIndexTrackUpdate` AFTER UPDATE ON `Tracks` BEGIN "
+                       "DELETE FROM `SearchIndex` WHERE rowid = old.`ID`; ") + insertSearchEntryText + QStringLiteral("END"),
+        QStringLiteral("CREATE TRIGGER IF NOT EXISTS `SearchIndexTrackDelete` AFTER DELETE ON `Tracks` BEGIN "
+                       "DELETE FROM `SearchIndex` WHERE rowid = old.`ID`; "
+                       "END"),
+    };
+
+    for (const auto &oneTrigger : allTriggers) {
+        QSqlQuery createTriggerQuery(d->mTracksDatabase);
+
+        const auto &result = createTriggerQuery.exec(oneTrigger);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initSearchIndex" << createTriggerQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initSearchIndex" << createTriggerQuery.lastError();
+        }
+    }
+
+    if (!searchIndexExists) {
+        QSqlQuery fillIndexQuery(d->mTracksDatabase);
+
+        const auto &result = fillIndexQuery.exec(QStringLiteral("INSERT INTO `SearchIndex` (rowid, `AlbumID`, `Title`, `Artist`, `AlbumTitle`, `AlbumArtist`) "
+                                                                "SELECT tracks.`ID`, tracks.`AlbumID`, tracks.`Title`, trackArtist.`Name`, album.`Title`, albumArtist.`Name` "
+                                                                "FROM `Tracks` tracks "
+                                                                "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                                "LEFT JOIN `Albums` album ON album.`ID` = tracks.`AlbumID` "
+                                                                "LEFT JOIN `Artists` albumArtist ON albumArtist.`ID` = album.`ArtistID`"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initSearchIndex" << fillIndexQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initSearchIndex" << fillIndexQuery.lastError();
+        }
+    }
+}
+
+void DatabaseInterface::initRequest()
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    {
+        auto selectAlbumQueryText = QStringLiteral("SELECT "
+                                                   "album.`ID`, "
+                                                   "album.`Title`, "
+                                                   "album.`AlbumInternalID`, "
+                                                   "artist.`Name`, "
+                                                   "album.`CoverFileName`, "
+                                                   "album.`TracksCount`, "
+                                                   "album.`IsSingleDiscAlbum`, "
+                                                   "(SELECT GROUP_CONCAT(trackArtist.`Name`, char(31)) FROM `Tracks` tracks "
+                                                   "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                   "WHERE tracks.`AlbumID` = album.`ID`), "
+                                                   "(SELECT GROUP_CONCAT(tracks.`Title`, char(31)) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`), "
+                                                   "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`) "
+                                                   "FROM `Albums` album, `Artists` artist "
+                                                   "WHERE "
+                                                   "album.`ID` = :albumId AND "
+                                                   "artist.`ID` = album.`ArtistID`");
+
+        auto result = d->mSelectAlbumQuery.prepare(selectAlbumQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectAlbumQuery.lastError();
+        }
+    }
+
+    {
+        auto selectAllAlbumsText = QStringLiteral("SELECT album.`ID`, "
+                                                  "album.`Title`, "
+                                                  "album.`AlbumInternalID`, "
+                                                  "artist.`Name`, "
+                                                  "album.`CoverFileName`, "
+                                                  "album.`TracksCount`, "
+                                                  "album.`IsSingleDiscAlbum`, "
+                                                  "tracks.`ID`, "
+                                                  "tracks.`Title`, "
+                                                  "trackArtist.`Name`, "
+                                                  "tracksMapping.`FileName`, "
+                                                  "tracks.`TrackNumber`, "
+                                                  "tracks.`DiscNumber`, "
+                                                  "tracks.`Duration`, "
+                                                  "tracks.`Rating` "
+                                                  "FROM `Albums` album "
+                                                  "JOIN `Artists` artist ON artist.`ID` = album.`ArtistID` "
+                                                  "LEFT JOIN `Tracks` tracks ON tracks.`AlbumID` = album.`ID` "
+                                                  "LEFT JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                  "LEFT JOIN `TracksMapping` tracksMapping ON tracksMapping.`TrackID` = tracks.`ID` AND tracksMapping.`Priority` = 1 "
+                                                  "ORDER BY album.`SortKey`, "
+                                                  "album.`ID`, "
+                                                  "tracks.`DiscNumber` ASC, "
+                                                  "tracks.`TrackNumber` ASC");
+
+        auto result = d->mSelectAllAlbumsQuery.prepare(selectAllAlbumsText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectAllAlbumsText << d->mSelectAllAlbumsQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
+        }
+    }
+
+    {
+        auto selectAlbumsPageText = QStringLiteral("SELECT album.`ID`, "
+                                                   "album.`Title`, "
+                                                   "album.`AlbumInternalID`, "
+                                                   "artist.`Name`, "
+                                                   "album.`CoverFileName`, "
+                                                   "album.`TracksCount`, "
+                                                   "album.`IsSingleDiscAlbum`, "
+                                                   "(SELECT GROUP_CONCAT(trackArtist.`Name`, char(31)) FROM `Tracks` tracks "
+                                                   "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                   "WHERE tracks.`AlbumID` = album.`ID`), "
+                                                   "(SELECT GROUP_CONCAT(tracks.`Title`, char(31)) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`), "
+                                                   "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`), "
+                                                   "album.`SortKey` "
+                                                   "FROM `Albums` album "
+                                                   "JOIN `Artists` artist ON artist.`ID` = album.`ArtistID` "
+                                                   "WHERE album.`SortKey` > :lastSortKey OR (album.`SortKey` = :lastSortKey AND album.`ID` > :lastId) "
+                                                   "ORDER BY album.`SortKey`, "
+                                                   "album.`ID` "
+                                                   "LIMIT :batchSize");
+
+        auto result = d->mSelectAlbumsPageQuery.prepare(selectAlbumsPageText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectAlbumsPageText << d->mSelectAlbumsPageQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
+        }
+    }
+
+    {
+        auto selectAlbumsWindowText = QStringLiteral("SELECT album.`ID`, "
+                                                     "album.`Title`, "
+                                                     "album.`AlbumInternalID`, "
+                                                     "artist.`Name`, "
+                                                     "album.`CoverFileName`, "
+                                                     "album.`TracksCount`, "
+                                                     "album.`IsSingleDiscAlbum`, "
+                                                     "(SELECT GROUP_CONCAT(trackArtist.`Name`, char(31)) FROM `Tracks` tracks "
+                                                     "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                     "WHERE tracks.`AlbumID` = album.`ID`), "
+                                                     "(SELECT GROUP_CONCAT(tracks.`Title`, char(31)) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`), "
+                                                     "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`) "
+                                                     "FROM `Albums` album "
+                                                     "JOIN `Artists` artist ON artist.`ID` = album.`ArtistID` "
+                                                     "WHERE %1"
+                                                     "(:minimumRating <= 0 OR "
+                                                     "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`) >= :minimumRating) "
+                                                     "ORDER BY album.`SortKey`, "
+                                                     "album.`ID` "
+                                                     "LIMIT :windowSize OFFSET :windowOffset");
+
+        auto selectAlbumsCountText = QStringLiteral("SELECT count(*) "
+                                                    "FROM `Albums` album "
+                                                    "JOIN `Artists` artist ON artist.`ID` = album.`ArtistID` "
+                                                    "WHERE %1"
+                                                    "(:minimumRating <= 0 OR "
+                                                    "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`) >= :minimumRating)");
+
+        auto matchingAlbumsText = QStringLiteral("album.`ID` IN (SELECT `AlbumID` "
+                                                 "FROM `SearchIndex` "
+                                                 "WHERE `SearchIndex` MATCH :searchText) AND ");
+
+        if (!d->mHasSearchIndex) {
+            matchingAlbumsText = QStringLiteral("album.`ID` IN (SELECT tracks.`AlbumID` "
+                                                "FROM `Tracks` tracks "
+                                                "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                "JOIN `Albums` trackAlbum ON trackAlbum.`ID` = tracks.`AlbumID` "
+                                                "JOIN `Artists` albumArtist ON albumArtist.`ID` = trackAlbum.`ArtistID` "
+                                                "WHERE tracks.`Title` LIKE :searchText OR "
+                                                "trackArtist.`Name` LIKE :searchText OR "
+                                                "trackAlbum.`Title` LIKE :searchText OR "
+                                                "albumArtist.`Name` LIKE :searchText) AND ");
+        }
+
+        const auto selectAllAlbumsWindowText = selectAlbumsWindowText.arg(QString());
+
+        auto result = d->mSelectAlbumsWindowQuery.prepare(selectAllAlbumsWindowText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectAllAlbumsWindowText << d->mSelectAlbumsWindowQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
+        }
+
+        const auto selectAllAlbumsCountText = selectAlbumsCountText.arg(QString());
+
+        result = d->mSelectAlbumsCountQuery.prepare(selectAllAlbumsCountText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectAllAlbumsCountText << d->mSelectAlbumsCountQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
+        }
 
-        if (!listColumns.contains(QStringLiteral("Rating"))) {
-            QSqlQuery alterSchemaQuery(d->mTracksDatabase);
+        const auto selectMatchingAlbumsWindowText = selectAlbumsWindowText.arg(matchingAlbumsText);
 
-            const auto &result = alterSchemaQuery.exec(QStringLiteral("ALTER TABLE `Tracks` "
-                                                                       "ADD COLUMN RATING INTEGER NOT NULL DEFAULT 0"));
+        result = d->mSelectMatchingAlbumsWindowQuery.prepare(selectMatchingAlbumsWindowText);
 
-            if (!result) {
-                qDebug() << "DatabaseInterface::initDatabase" << alterSchemaQuery.lastError();
-            }
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectMatchingAlbumsWindowText << d->mSelectMatchingAlbumsWindowQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
-    }
 
-    if (!listTables.contains(QStringLiteral("TracksMapping"))) {
-        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+        const auto selectMatchingAlbumsCountText = selectAlbumsCountText.arg(matchingAlbumsText);
 
-        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `TracksMapping` ("
-                                                                   "`TrackID` INTEGER NULL, "
-                                                                   "`DiscoverID` INTEGER NOT NULL, "
-                                                                   "`FileName` VARCHAR(255) NOT NULL, "
-                                                                   "`Priority` INTEGER NOT NULL, "
-                                                                   "`TrackValid` BOOLEAN NOT NULL, "
-                                                                   "PRIMARY KEY (`FileName`), "
-                                                                   "CONSTRAINT TracksUnique UNIQUE (`TrackID`, `Priority`), "
-                                                                   "CONSTRAINT fk_tracksmapping_trackID FOREIGN KEY (`TrackID`) REFERENCES `Tracks`(`ID`), "
-                                                                   "CONSTRAINT fk_tracksmapping_discoverID FOREIGN KEY (`DiscoverID`) REFERENCES `DiscoverSource`(`ID`))"));
+        result = d->mSelectMatchingAlbumsCountQuery.prepare(selectMatchingAlbumsCountText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectMatchingAlbumsCountText << d->mSelectMatchingAlbumsCountQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
-
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksAlbumIndex` ON `Tracks` "
-                                                                  "(`AlbumID`)"));
+        auto selectArtistAlbumsText = QStringLiteral("SELECT album.`ID`, "
+                                                     "album.`Title`, "
+                                                     "album.`AlbumInternalID`, "
+                                                     "artist.`Name`, "
+                                                     "album.`CoverFileName`, "
+                                                     "album.`TracksCount`, "
+                                                     "album.`IsSingleDiscAlbum`, "
+                                                     "(SELECT GROUP_CONCAT(trackArtist.`Name`, char(31)) FROM `Tracks` tracks "
+                                                     "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                                     "WHERE tracks.`AlbumID` = album.`ID`), "
+                                                     "(SELECT GROUP_CONCAT(tracks.`Title`, char(31)) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`), "
+                                                     "(SELECT MAX(tracks.`Rating`) FROM `Tracks` tracks WHERE tracks.`AlbumID` = album.`ID`) "
+                                                     "FROM `Albums` album "
+                                                     "JOIN `Artists` artist ON artist.`ID` = album.`ArtistID` "
+                                                     "WHERE album.`ArtistID` = :artistId OR "
+                                                     "album.`ID` IN (SELECT tracks.`AlbumID` FROM `Tracks` tracks WHERE tracks.`ArtistID` = :artistId) "
+                                                     "ORDER BY album.`SortKey`, "
+                                                     "album.`ID`");
+
+        auto result = d->mSelectArtistAlbumsQuery.prepare(selectArtistAlbumsText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectArtistAlbumsText << d->mSelectArtistAlbumsQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        auto selectArtistsWindowText = QStringLiteral("SELECT artist.`ID`, "
+                                                      "artist.`Name`, "
+                                                      "(SELECT count(*) FROM `Albums` album WHERE album.`ArtistID` = artist.`ID`) "
+                                                      "FROM `Artists` artist "
+                                                      "ORDER BY artist.`SortKey`, "
+                                                      "artist.`ID` "
+                                                      "LIMIT :windowSize OFFSET :windowOffset");
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`AlbumsArtistIndex` ON `Albums` "
-                                                                  "(`ArtistID`)"));
+        auto result = d->mSelectArtistsWindowQuery.prepare(selectArtistsWindowText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectArtistsWindowText << d->mSelectArtistsWindowQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        auto selectArtistsCountText = QStringLiteral("SELECT count(*) "
+                                                     "FROM `Artists` artist");
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksFileNameIndex` ON `TracksMapping` "
-                                                                  "(`FileName`)"));
+        auto result = d->mSelectArtistsCountQuery.prepare(selectArtistsCountText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectArtistsCountText << d->mSelectArtistsCountQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        auto searchLibraryText = QStringLiteral("SELECT rowid, `AlbumID` "
+                                                "FROM `SearchIndex` "
+                                                "WHERE `SearchIndex` MATCH :searchText");
+
+        if (!d->mHasSearchIndex) {
+            searchLibraryText = QStringLiteral("SELECT tracks.`ID`, tracks.`AlbumID` "
+                                               "FROM `Tracks` tracks "
+                                               "JOIN `Artists` trackArtist ON trackArtist.`ID` = tracks.`ArtistID` "
+                                               "JOIN `Albums` album ON album.`ID` = tracks.`AlbumID` "
+                                               "JOIN `Artists` albumArtist ON albumArtist.`ID` = album.`ArtistID` "
+                                               "WHERE tracks.`Title` LIKE :searchText OR "
+                                               "trackArtist.`Name` LIKE :searchText OR "
+                                               "album.`Title` LIKE :searchText OR "
+                                               "albumArtist.`Name` LIKE :searchText");
+        }
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksArtistIDAlbumIDFileNameIndex` ON `Tracks` "
-                                                                  "(`ArtistID`, `AlbumID`)"));
+        auto result = d->mSearchLibraryQuery.prepare(searchLibraryText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initDatabase" << createTrackIndex.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << searchLibraryText << d->mSearchLibraryQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
-    transactionResult = finishTransaction();
-    if (!transactionResult) {
-        return;
-    }
-}
-
-void DatabaseInterface::initRequest()
-{
-    auto transactionResult = startTransaction();
-    if (!transactionResult) {
-        return;
-    }
-
     {
-        auto selectAlbumQueryText = QStringLiteral("SELECT "
-                                                   "album.`ID`, "
-                                                   "album.`Title`, "
-                                                   "album.`AlbumInternalID`, "
-                                                   "artist.`Name`, "
-                                                   "album.`CoverFileName`, "
-                                                   "album.`TracksCount`, "
-                                                   "album.`IsSingleDiscAlbum` "
-                                                   "FROM `Albums` album, `Artists` artist "
-                                                   "WHERE "
-                                                   "album.`ID` = :albumId AND "
-                                                   "artist.`ID` = album.`ArtistID`");
-
-        auto result = d->mSelectAlbumQuery.prepare(selectAlbumQueryText);
+        auto selectArtistsPageText = QStringLiteral("SELECT artist.`ID`, "
+                                                    "artist.`Name`, "
+                                                    "(SELECT count(*) FROM `Albums` album WHERE album.`ArtistID` = artist.`ID`), "
+                                                    "artist.`SortKey` "
+                                                    "FROM `Artists` artist "
+                                                    "WHERE artist.`SortKey` > :lastSortKey OR (artist.`SortKey` = :lastSortKey AND artist.`ID` > :lastId) "
+                                                    "ORDER BY artist.`SortKey`, "
+                                                    "artist.`ID` "
+                                                    "LIMIT :batchSize");
+
+        auto result = d->mSelectArtistsPageQuery.prepare(selectArtistsPageText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initRequest" << d->mSelectAlbumQuery.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectArtistsPageText << d->mSelectArtistsPageQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
         }
     }
 
     {
-        auto selectAllAlbumsText = QStringLiteral("SELECT album.`ID`, "
-                                                  "album.`Title`, "
-                                                  "album.`AlbumInternalID`, "
-                                                  "artist.`Name`, "
-                                                  "album.`CoverFileName`, "
-                                                  "album.`TracksCount`, "
-                                                  "album.`IsSingleDiscAlbum` "
-                                                  "FROM `Albums` album, `Artists` artist "
-                                                  "WHERE "
-                                                  "artist.`ID` = album.`ArtistID` "
-                                                  "ORDER BY album.`Title`");
+        auto selectTracksIdPageText = QStringLiteral("SELECT tracks.`ID` "
+                                                     "FROM `Tracks` tracks, `TracksMapping` tracksMapping "
+                                                     "WHERE "
+                                                     "tracks.`ID` > :lastId AND "
+                                                     "tracksMapping.`TrackID` = tracks.`ID` AND "
+                                                     "tracksMapping.`Priority` = 1 "
+                                                     "ORDER BY tracks.`ID` "
+                                                     "LIMIT :batchSize");
 
-        auto result = d->mSelectAllAlbumsQuery.prepare(selectAllAlbumsText);
+        auto result = d->mSelectTracksIdPageQuery.prepare(selectTracksIdPageText);
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initRequest" << selectAllAlbumsText << d->mSelectAllAlbumsQuery.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << selectTracksIdPageText << d->mSelectTracksIdPageQuery.lastError();
             qDebug() << d->mTracksDatabase.lastError();
         }
     }
@@ -1120,7 +2349,8 @@ void DatabaseInterface::initRequest()
     {
         auto selectAllArtistsWithFilterText = QStringLiteral("SELECT `ID`, "
                                                             "`Name` "
-                                                            "FROM `Artists`");
+                                                            "FROM `Artists` "
+                                                            "ORDER BY `SortKey`, `ID`");
 
         auto result = d->mSelectAllArtistsQuery.prepare(selectAllArtistsWithFilterText);
 
@@ -1220,6 +2450,23 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto selectAllTrackFilesFromSourceQueryText = QStringLiteral("SELECT tracksMapping.`FileName`, "
+                                                                     "tracksMapping.`FileSize`, "
+                                                                     "tracksMapping.`FileModifiedTime` "
+                                                                     "FROM `TracksMapping` tracksMapping, `DiscoverSource` source "
+                                                                     "WHERE "
+                                                                     "source.`Name` = :source AND "
+                                                                     "source.`ID` = tracksMapping.`DiscoverID`");
+
+        auto result = d->mSelectAllTrackFilesFromSourceQuery.prepare(selectAllTrackFilesFromSourceQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << selectAllTrackFilesFromSourceQueryText << d->mSelectAllTrackFilesFromSourceQuery.lastError();
+            qDebug() << d->mTracksDatabase.lastError();
+        }
+    }
+
     {
         auto selectArtistByNameText = QStringLiteral("SELECT `ID`, "
                                                      "`Name` "
@@ -1236,8 +2483,8 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto insertArtistsText = QStringLiteral("INSERT INTO `Artists` (`ID`, `Name`) "
-                                                             "VALUES (:artistId, :name)");
+        auto insertArtistsText = QStringLiteral("INSERT INTO `Artists` (`ID`, `Name`, `SortKey`) "
+                                                             "VALUES (:artistId, :name, :sortKey)");
 
         auto result = d->mInsertArtistsQuery.prepare(insertArtistsText);
 
@@ -1291,7 +2538,8 @@ void DatabaseInterface::initRequest()
                                                          "tracks.`DiscNumber`, "
                                                          "tracks.`Duration`, "
                                                          "tracks.`Rating`, "
-                                                         "album.`CoverFileName` "
+                                                         "album.`CoverFileName`, "
+                                                         "album.`Title` "
                                                          "FROM `Tracks` tracks, `Artists` artist, `Artists` artistAlbum, `Albums` album, `TracksMapping` tracksMapping "
                                                          "WHERE "
                                                          "tracks.`ID` = :trackId AND "
@@ -1331,8 +2579,20 @@ void DatabaseInterface::initRequest()
         }
     }
     {
-        auto insertAlbumQueryText = QStringLiteral("INSERT INTO Albums (`ID`, `Title`, `ArtistID`, `CoverFileName`, `TracksCount`, `IsSingleDiscAlbum`) "
-                                                   "VALUES (:albumId, :title, :artistId, :coverFileName, :tracksCount, :isSingleDiscAlbum)");
+        auto selectAlbumIdFromTitleAndArtistQueryText = QStringLiteral("SELECT `ID` FROM `Albums` "
+                                                                       "WHERE "
+                                                                       "`Title` = :title AND "
+                                                                       "`ArtistID` = :artistId");
+
+        auto result = d->mSelectAlbumIdFromTitleAndArtistQuery.prepare(selectAlbumIdFromTitleAndArtistQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastError();
+        }
+    }
+    {
+        auto insertAlbumQueryText = QStringLiteral("INSERT INTO Albums (`ID`, `Title`, `ArtistID`, `CoverFileName`, `TracksCount`, `IsSingleDiscAlbum`, `SortKey`) "
+                                                   "VALUES (:albumId, :title, :artistId, :coverFileName, :tracksCount, :isSingleDiscAlbum, :sortKey)");
 
         auto result = d->mInsertAlbumQuery.prepare(insertAlbumQueryText);
 
@@ -1342,8 +2602,8 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto insertTrackMappingQueryText = QStringLiteral("INSERT INTO `TracksMapping` (`FileName`, `DiscoverID`, `Priority`, `TrackValid`) "
-                                                   "VALUES (:fileName, :discoverId, :priority, 1)");
+        auto insertTrackMappingQueryText = QStringLiteral("INSERT INTO `TracksMapping` (`FileName`, `DiscoverID`, `Priority`, `TrackValid`, `FileSize`, `FileModifiedTime`) "
+                                                   "VALUES (:fileName, :discoverId, :priority, 1, :fileSize, :fileModifiedTime)");
 
         auto result = d->mInsertTrackMapping.prepare(insertTrackMappingQueryText);
 
@@ -1363,7 +2623,10 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto initialUpdateTracksValidityQueryText = QStringLiteral("UPDATE `TracksMapping` SET `TrackValid` = 1, `TrackID` = :trackId, `Priority` = :priority "
+        auto initialUpdateTracksValidityQueryText = QStringLiteral("UPDATE `TracksMapping` SET `TrackValid` = 1, `TrackID` = :trackId, "
+                                                                   "`Priority` = (SELECT count(*) FROM `TracksMapping` otherMapping "
+                                                                   "WHERE otherMapping.`TrackID` = :trackId AND otherMapping.`FileName` != :fileName) + 1, "
+                                                                   "`FileSize` = :fileSize, `FileModifiedTime` = :fileModifiedTime "
                                                                    "WHERE `FileName` = :fileName");
 
         auto result = d->mUpdateTrackMapping.prepare(initialUpdateTracksValidityQueryText);
@@ -1384,12 +2647,10 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto selectTracksMappingPriorityQueryText = QStringLiteral("SELECT count(*) FROM `TracksMapping` WHERE `TrackID` = :trackId AND `FileName` != :fileName");
-
-        auto result = d->mSelectTracksMappingPriority.prepare(selectTracksMappingPriorityQueryText);
+        auto result = d->mSelectTracksMappingFromFileNamesQuery.prepare(selectTracksMappingFromFileNamesQueryText(d->mSelectTracksFromIdsBatchSize));
 
         if (!result) {
-            qDebug() << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriority.lastError();
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectTracksMappingFromFileNamesQuery.lastError();
         }
     }
 
@@ -1432,14 +2693,45 @@ void DatabaseInterface::initRequest()
             qDebug() << "DatabaseInterface::initRequest" << d->mSelectTrackIdFromTitleAlbumIdArtistQuery.lastError();
         }
 
-        auto insertTrackQueryText = QStringLiteral("INSERT INTO `Tracks` (`ID`, `Title`, `AlbumID`, `ArtistID`, `TrackNumber`, `DiscNumber`, `Duration`, `Rating`) "
-                                                   "VALUES (:trackId, :title, :album, :artistId, :trackNumber, :discNumber, :trackDuration, :trackRating)");
+        auto insertTrackQueryText = QStringLiteral("INSERT INTO `Tracks` (`ID`, `Title`, `AlbumID`, `ArtistID`, `TrackNumber`, `DiscNumber`, `Duration`, `Rating`, `SortKey`) "
+                                                   "VALUES (:trackId, :title, :album, :artistId, :trackNumber, :discNumber, :trackDuration, :trackRating, :sortKey)");
 
         result = d->mInsertTrackQuery.prepare(insertTrackQueryText);
 
         if (!result) {
             qDebug() << "DatabaseInterface::initRequest" << d->mInsertTrackQuery.lastError();
         }
+
+        result = d->mInsertTracksBatchQuery.prepare(insertTracksBatchQueryText(d->mInsertTracksBatchSize));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mInsertTracksBatchQuery.lastError();
+        }
+
+        result = d->mInsertTracksMappingBatchQuery.prepare(insertTracksMappingBatchQueryText(d->mInsertTracksBatchSize));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mInsertTracksMappingBatchQuery.lastError();
+        }
+    }
+    {
+        auto result = d->mSelectTracksFromIdsQuery.prepare(selectTracksFromIdsQueryText(d->mSelectTracksFromIdsBatchSize));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectTracksFromIdsQuery.lastError();
+        }
+
+        result = d->mSelectTracksKeyFromIdsQuery.prepare(selectTracksKeyFromIdsQueryText(d->mSelectTracksFromIdsBatchSize));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectTracksKeyFromIdsQuery.lastError();
+        }
+
+        result = d->mSelectTracksKeyFromAlbumsTitleQuery.prepare(selectTracksKeyFromAlbumsTitleQueryText(d->mSelectTracksFromIdsBatchSize));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectTracksKeyFromAlbumsTitleQuery.lastError();
+        }
     }
     {
         auto selectTrackQueryText = QStringLiteral("SELECT "
@@ -1519,8 +2811,8 @@ void DatabaseInterface::initRequest()
                                                               "albumArtist.`ID` = albums.`ArtistID` AND "
                                                               "tracksMapping.`TrackID` = tracks.`ID` AND "
                                                               "tracksMapping.`Priority` = 1 "
-                                                              "ORDER BY tracks.`Title` ASC, "
-                                                              "albums.`Title` ASC");
+                                                              "ORDER BY tracks.`SortKey` ASC, "
+                                                              "albums.`SortKey` ASC");
 
         auto result = d->mSelectTracksFromArtist.prepare(selectTracksFromArtistQueryText);
 
@@ -1627,37 +2919,40 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
         return result;
     }
 
-    d->mSelectAlbumIdFromTitleQuery.bindValue(QStringLiteral(":title"), title);
-    d->mSelectAlbumIdFromTitleQuery.bindValue(QStringLiteral(":artistId"), insertArtist(albumArtist));
+    const auto albumArtistId = insertArtist(albumArtist);
 
-    auto queryResult = d->mSelectAlbumIdFromTitleQuery.exec();
+    d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":title"), title);
+    d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":artistId"), albumArtistId);
 
-    if (!queryResult || !d->mSelectAlbumIdFromTitleQuery.isSelect() || !d->mSelectAlbumIdFromTitleQuery.isActive()) {
-        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleQuery.lastQuery();
-        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleQuery.boundValues();
-        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleQuery.lastError();
+    auto queryResult = d->mSelectAlbumIdFromTitleAndArtistQuery.exec();
 
-        d->mSelectAlbumIdFromTitleQuery.finish();
+    if (!queryResult || !d->mSelectAlbumIdFromTitleAndArtistQuery.isSelect() || !d->mSelectAlbumIdFromTitleAndArtistQuery.isActive()) {
+        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastQuery();
+        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.boundValues();
+        qDebug() << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastError();
+
+        d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
 
         return result;
     }
 
-    if (d->mSelectAlbumIdFromTitleQuery.next()) {
-        result = d->mSelectAlbumIdFromTitleQuery.record().value(0).toULongLong();
+    if (d->mSelectAlbumIdFromTitleAndArtistQuery.next()) {
+        result = d->mSelectAlbumIdFromTitleAndArtistQuery.record().value(0).toULongLong();
 
-        d->mSelectAlbumIdFromTitleQuery.finish();
+        d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
 
         return result;
     }
 
-    d->mSelectAlbumIdFromTitleQuery.finish();
+    d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
 
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":albumId"), d->mAlbumId);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":title"), title);
-    d->mInsertAlbumQuery.bindValue(QStringLiteral(":artistId"), insertArtist(albumArtist));
+    d->mInsertAlbumQuery.bindValue(QStringLiteral(":artistId"), albumArtistId);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":coverFileName"), albumArtURI);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":tracksCount"), tracksCount);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":isSingleDiscAlbum"), isSingleDiscAlbum);
+    d->mInsertAlbumQuery.bindValue(QStringLiteral(":sortKey"), sortKeyFromText(title));
 
     queryResult = d->mInsertAlbumQuery.exec();
 
@@ -1677,7 +2972,7 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
 
     d->mInsertAlbumQuery.finish();
 
-    Q_EMIT albumAdded(internalAlbumFromId(d->mAlbumId - 1));
+    d->mPendingAddedAlbumIds.push_back(d->mAlbumId - 1);
 
     return result;
 }
@@ -1735,6 +3030,7 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
 
     d->mInsertArtistsQuery.bindValue(QStringLiteral(":artistId"), d->mArtistId);
     d->mInsertArtistsQuery.bindValue(QStringLiteral(":name"), name);
+    d->mInsertArtistsQuery.bindValue(QStringLiteral(":sortKey"), sortKeyFromText(name));
 
     queryResult = d->mInsertArtistsQuery.exec();
 
@@ -1754,16 +3050,18 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
 
     d->mInsertArtistsQuery.finish();
 
-    Q_EMIT artistAdded(internalArtistFromId(d->mArtistId - 1));
+    d->mPendingAddedArtistIds.push_back(d->mArtistId - 1);
 
     return result;
 }
 
-void DatabaseInterface::insertTrackOrigin(const QUrl &fileNameURI, qulonglong discoverId)
+void DatabaseInterface::insertTrackOrigin(const QUrl &fileNameURI, qint64 fileSize, const QDateTime &fileModifiedTime, qulonglong discoverId)
 {
     d->mInsertTrackMapping.bindValue(QStringLiteral(":discoverId"), discoverId);
     d->mInsertTrackMapping.bindValue(QStringLiteral(":fileName"), fileNameURI);
     d->mInsertTrackMapping.bindValue(QStringLiteral(":priority"), 1);
+    d->mInsertTrackMapping.bindValue(QStringLiteral(":fileSize"), (fileSize >= 0 ? QVariant::fromValue(fileSize) : QVariant()));
+    d->mInsertTrackMapping.bindValue(QStringLiteral(":fileModifiedTime"), (fileModifiedTime.isValid() ? QVariant::fromValue(fileModifiedTime.toMSecsSinceEpoch()) : QVariant()));
 
     auto queryResult = d->mInsertTrackMapping.exec();
 
@@ -1780,11 +3078,12 @@ void DatabaseInterface::insertTrackOrigin(const QUrl &fileNameURI, qulonglong di
     d->mInsertTrackMapping.finish();
 }
 
-void DatabaseInterface::updateTrackOrigin(qulonglong trackId, const QUrl &fileName)
+void DatabaseInterface::updateTrackOrigin(qulonglong trackId, const QUrl &fileName, qint64 fileSize, const QDateTime &fileModifiedTime)
 {
     d->mUpdateTrackMapping.bindValue(QStringLiteral(":trackId"), trackId);
     d->mUpdateTrackMapping.bindValue(QStringLiteral(":fileName"), fileName);
-    d->mUpdateTrackMapping.bindValue(QStringLiteral(":priority"), computeTrackPriority(trackId, fileName) + 1);
+    d->mUpdateTrackMapping.bindValue(QStringLiteral(":fileSize"), (fileSize >= 0 ? QVariant::fromValue(fileSize) : QVariant()));
+    d->mUpdateTrackMapping.bindValue(QStringLiteral(":fileModifiedTime"), (fileModifiedTime.isValid() ? QVariant::fromValue(fileModifiedTime.toMSecsSinceEpoch()) : QVariant()));
 
     auto queryResult = d->mUpdateTrackMapping.exec();
 
@@ -1801,95 +3100,461 @@ void DatabaseInterface::updateTrackOrigin(qulonglong trackId, const QUrl &fileNa
     d->mInsertTrackMapping.finish();
 }
 
-int DatabaseInterface::computeTrackPriority(qulonglong trackId, const QUrl &fileName)
+void DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrack, const QHash<QString, QUrl> &covers,
+                                            qulonglong discoverId, QSet<qulonglong> &insertedAlbumIds)
+{
+    if (oneTrack.albumArtist().isEmpty()) {
+        return;
+    }
+
+    auto albumId = batchAlbumId(oneTrack.albumName(), oneTrack.albumArtist(), covers[oneTrack.albumName()]);
+    auto artistId = batchArtistId(oneTrack.artist());
+
+    auto newTrack = PendingTrackInsert();
+    newTrack.mTrack = oneTrack;
+    newTrack.mAlbumId = albumId;
+    newTrack.mArtistId = artistId;
+    newTrack.mDiscoverId = discoverId;
+
+    const auto pendingKey = qMakePair(oneTrack.title(), qMakePair(albumId, artistId));
+    auto pendingTrack = d->mPendingTracksIndex.find(pendingKey);
+
+    if (pendingTrack != d->mPendingTracksIndex.end()) {
+        auto &replacedTrack = d->mPendingTracks[pendingTrack.value()];
+
+        replacedTrack.mIsReplaced = true;
+
+        newTrack.mIsModified = true;
+    }
+
+    d->mPendingTracksIndex[pendingKey] = d->mPendingTracks.size();
+    d->mPendingTracks.push_back(newTrack);
+
+    insertedAlbumIds.insert(albumId);
+}
+
+void DatabaseInterface::flushPendingTracks(QSet<qulonglong> &modifiedAlbumIds)
+{
+    if (d->mPendingTracks.isEmpty()) {
+        return;
+    }
+
+    resolvePendingTracksIds();
+
+    auto insertedRowsCount = 0;
+    for (const auto &onePendingTrack : d->mPendingTracks) {
+        if (!onePendingTrack.mIsReplaced) {
+            ++insertedRowsCount;
+        }
+    }
+
+    QSqlQuery partialBatchQuery(d->mTracksDatabase);
+    auto *insertQuery = &d->mInsertTracksBatchQuery;
+
+    if (insertedRowsCount != d->mInsertTracksBatchSize) {
+        partialBatchQuery.prepare(insertTracksBatchQueryText(insertedRowsCount));
+        insertQuery = &partialBatchQuery;
+    }
+
+    auto parameterIndex = 0;
+    for (const auto &onePendingTrack : d->mPendingTracks) {
+        if (onePendingTrack.mIsReplaced) {
+            continue;
+        }
+
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrackId);
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrack.title());
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mAlbumId);
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mArtistId);
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrack.trackNumber());
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrack.discNumber());
+        insertQuery->bindValue(parameterIndex++, QVariant::fromValue<qlonglong>(onePendingTrack.mTrack.duration().msecsSinceStartOfDay()));
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrack.rating());
+        insertQuery->bindValue(parameterIndex++, sortKeyFromText(onePendingTrack.mTrack.title()));
+    }
+
+    QSet<qulonglong> insertedTrackIds;
+
+    auto result = insertQuery->exec();
+
+    if (result && insertQuery->isActive()) {
+        insertQuery->finish();
+
+        for (const auto &onePendingTrack : d->mPendingTracks) {
+            insertedTrackIds.insert(onePendingTrack.mTrackId);
+        }
+    } else {
+        qDebug() << "DatabaseInterface::flushPendingTracks" << insertQuery->lastQuery();
+        qDebug() << "DatabaseInterface::flushPendingTracks" << insertQuery->lastError();
+
+        insertQuery->finish();
+
+        for (const auto &onePendingTrack : d->mPendingTracks) {
+            if (onePendingTrack.mIsReplaced) {
+                continue;
+            }
+
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackId"), onePendingTrack.mTrackId);
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":title"), onePendingTrack.mTrack.title());
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":album"), onePendingTrack.mAlbumId);
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":artistId"), onePendingTrack.mArtistId);
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackNumber"), onePendingTrack.mTrack.trackNumber());
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":discNumber"), onePendingTrack.mTrack.discNumber());
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackDuration"), QVariant::fromValue<qlonglong>(onePendingTrack.mTrack.duration().msecsSinceStartOfDay()));
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackRating"), onePendingTrack.mTrack.rating());
+            d->mInsertTrackQuery.bindValue(QStringLiteral(":sortKey"), sortKeyFromText(onePendingTrack.mTrack.title()));
+
+            auto oneResult = d->mInsertTrackQuery.exec();
+
+            if (oneResult && d->mInsertTrackQuery.isActive()) {
+                insertedTrackIds.insert(onePendingTrack.mTrackId);
+            } else {
+                qDebug() << "DatabaseInterface::flushPendingTracks" << d->mInsertTrackQuery.lastQuery();
+                qDebug() << "DatabaseInterface::flushPendingTracks" << d->mInsertTrackQuery.boundValues();
+                qDebug() << "DatabaseInterface::flushPendingTracks" << d->mInsertTrackQuery.lastError();
+            }
+
+            d->mInsertTrackQuery.finish();
+        }
+    }
+
+    updatePendingTracksOrigin(insertedTrackIds);
+
+    for (const auto &onePendingTrack : d->mPendingTracks) {
+        if (!insertedTrackIds.contains(onePendingTrack.mTrackId)) {
+            continue;
+        }
+
+        if (onePendingTrack.mIsModified) {
+            d->mPendingModifiedTrackIds.insert(onePendingTrack.mTrackId);
+            modifiedAlbumIds.insert(onePendingTrack.mAlbumId);
+        } else {
+            d->mPendingAddedTrackIds.push_back(onePendingTrack.mTrackId);
+        }
+    }
+
+    d->mPendingTracks.clear();
+    d->mPendingTracksIndex.clear();
+}
+
+void DatabaseInterface::resolvePendingTracksIds()
+{
+    auto albumsTitles = QList<QString>();
+    auto knownAlbumsTitles = QSet<QString>();
+
+    for (const auto &onePendingTrack : d->mPendingTracks) {
+        if (!onePendingTrack.mIsReplaced && !knownAlbumsTitles.contains(onePendingTrack.mTrack.albumName())) {
+            knownAlbumsTitles.insert(onePendingTrack.mTrack.albumName());
+            albumsTitles.push_back(onePendingTrack.mTrack.albumName());
+        }
+    }
+
+    const auto allRecords = recordsFromValues(d->mTracksDatabase, d->mSelectTracksKeyFromAlbumsTitleQuery, selectTracksKeyFromAlbumsTitleQueryText,
+                                              d->mSelectTracksFromIdsBatchSize, albumsTitles);
+
+    auto existingTracksIds = QHash<QPair<QString, QPair<QString, QString>>, qulonglong>();
+    existingTracksIds.reserve(allRecords.size());
+
+    for (const auto &currentRecord : allRecords) {
+        const auto trackKey = qMakePair(currentRecord.value(1).toString(),
+                                        qMakePair(currentRecord.value(2).toString(), currentRecord.value(3).toString()));
+
+        if (!existingTracksIds.contains(trackKey)) {
+            existingTracksIds[trackKey] = currentRecord.value(0).toULongLong();
+        }
+    }
+
+    for (auto &onePendingTrack : d->mPendingTracks) {
+        if (onePendingTrack.mIsReplaced) {
+            continue;
+        }
+
+        const auto trackKey = qMakePair(onePendingTrack.mTrack.title(),
+                                        qMakePair(onePendingTrack.mTrack.albumName(), onePendingTrack.mTrack.artist()));
+        auto existingTrack = existingTracksIds.find(trackKey);
+
+        if (existingTrack != existingTracksIds.end()) {
+            removeTrackInDatabase(existingTrack.value());
+
+            onePendingTrack.mTrackId = existingTrack.value();
+            onePendingTrack.mIsModified = true;
+
+            existingTracksIds.erase(existingTrack);
+        } else {
+            onePendingTrack.mTrackId = d->mTrackId;
+            ++d->mTrackId;
+        }
+    }
+
+    for (auto &onePendingTrack : d->mPendingTracks) {
+        if (!onePendingTrack.mIsReplaced) {
+            continue;
+        }
+
+        const auto pendingKey = qMakePair(onePendingTrack.mTrack.title(), qMakePair(onePendingTrack.mAlbumId, onePendingTrack.mArtistId));
+
+        onePendingTrack.mTrackId = d->mPendingTracks[d->mPendingTracksIndex.value(pendingKey)].mTrackId;
+    }
+}
+
+void DatabaseInterface::updatePendingTracksOrigin(const QSet<qulonglong> &insertedTrackIds)
 {
-    auto result = int(0);
+    auto fileNames = QList<QUrl>();
+    auto fileNamesIndex = QHash<QUrl, int>();
+
+    for (int pendingIndex = 0; pendingIndex < d->mPendingTracks.size(); ++pendingIndex) {
+        const auto &fileName = d->mPendingTracks[pendingIndex].mTrack.resourceURI();
+
+        if (!fileNamesIndex.contains(fileName)) {
+            fileNames.push_back(fileName);
+        }
+
+        fileNamesIndex[fileName] = pendingIndex;
+    }
+
+    const auto allRecords = recordsFromValues(d->mTracksDatabase, d->mSelectTracksMappingFromFileNamesQuery, selectTracksMappingFromFileNamesQueryText,
+                                              d->mSelectTracksFromIdsBatchSize, fileNames);
+
+    auto existingOrigins = QHash<QUrl, qulonglong>();
+    existingOrigins.reserve(allRecords.size());
+
+    for (const auto &currentRecord : allRecords) {
+        existingOrigins[currentRecord.value(0).toUrl()] = currentRecord.value(1).toULongLong();
+    }
+
+    auto newOrigins = QList<int>();
+
+    for (const auto &fileName : fileNames) {
+        const auto pendingIndex = fileNamesIndex.value(fileName);
+        const auto &onePendingTrack = d->mPendingTracks[pendingIndex];
+        const auto existingOrigin = existingOrigins.constFind(fileName);
+
+        if (existingOrigin == existingOrigins.constEnd()) {
+            newOrigins.push_back(pendingIndex);
+            continue;
+        }
+
+        const auto trackId = (insertedTrackIds.contains(onePendingTrack.mTrackId) ? onePendingTrack.mTrackId : existingOrigin.value());
+
+        updateTrackOrigin(trackId, fileName, onePendingTrack.mTrack.fileSize(), onePendingTrack.mTrack.fileModifiedTime());
+    }
+
+    if (newOrigins.isEmpty()) {
+        return;
+    }
+
+    QSqlQuery partialBatchQuery(d->mTracksDatabase);
+    auto *insertQuery = &d->mInsertTracksMappingBatchQuery;
+
+    if (newOrigins.size() != d->mInsertTracksBatchSize) {
+        partialBatchQuery.prepare(insertTracksMappingBatchQueryText(newOrigins.size()));
+        insertQuery = &partialBatchQuery;
+    }
+
+    // rows of a same track get increasing priorities, whether or not the
+    // priority subquery sees the rows inserted before them by this statement
+    auto trackOriginsCount = QHash<qulonglong, int>();
+
+    auto parameterIndex = 0;
+    for (auto pendingIndex : newOrigins) {
+        const auto &onePendingTrack = d->mPendingTracks[pendingIndex];
+        const auto isInserted = insertedTrackIds.contains(onePendingTrack.mTrackId);
+        const auto trackId = (isInserted ? QVariant::fromValue(onePendingTrack.mTrackId) : QVariant());
+        const auto fileSize = onePendingTrack.mTrack.fileSize();
+        const auto &fileModifiedTime = onePendingTrack.mTrack.fileModifiedTime();
+
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mTrack.resourceURI());
+        insertQuery->bindValue(parameterIndex++, onePendingTrack.mDiscoverId);
+        insertQuery->bindValue(parameterIndex++, trackId);
+        insertQuery->bindValue(parameterIndex++, (isInserted ? ++trackOriginsCount[onePendingTrack.mTrackId] : 1));
+        insertQuery->bindValue(parameterIndex++, trackId);
+        insertQuery->bindValue(parameterIndex++, (fileSize >= 0 ? QVariant::fromValue(fileSize) : QVariant()));
+        insertQuery->bindValue(parameterIndex++, (fileModifiedTime.isValid() ? QVariant::fromValue(fileModifiedTime.toMSecsSinceEpoch()) : QVariant()));
+    }
+
+    auto result = insertQuery->exec();
+
+    if (result && insertQuery->isActive()) {
+        insertQuery->finish();
 
-    if (!d) {
-        return result;
+        return;
     }
 
-    d->mSelectTracksMappingPriority.bindValue(QStringLiteral(":trackId"), trackId);
-    d->mSelectTracksMappingPriority.bindValue(QStringLiteral(":fileName"), fileName);
+    qDebug() << "DatabaseInterface::updatePendingTracksOrigin" << insertQuery->lastQuery();
+    qDebug() << "DatabaseInterface::updatePendingTracksOrigin" << insertQuery->lastError();
 
-    auto queryResult = d->mSelectTracksMappingPriority.exec();
+    insertQuery->finish();
 
-    if (!queryResult || !d->mSelectTracksMappingPriority.isSelect() || !d->mSelectTracksMappingPriority.isActive()) {
-        qDebug() << "DatabaseInterface::internalTrackIdFromFileName" << d->mSelectTracksMappingPriority.lastQuery();
-        qDebug() << "DatabaseInterface::internalTrackIdFromFileName" << d->mSelectTracksMappingPriority.boundValues();
-        qDebug() << "DatabaseInterface::internalTrackIdFromFileName" << d->mSelectTracksMappingPriority.lastError();
+    for (auto pendingIndex : newOrigins) {
+        const auto &onePendingTrack = d->mPendingTracks[pendingIndex];
 
-        d->mSelectTracksMappingPriority.finish();
+        insertTrackOrigin(onePendingTrack.mTrack.resourceURI(), onePendingTrack.mTrack.fileSize(),
+                          onePendingTrack.mTrack.fileModifiedTime(), onePendingTrack.mDiscoverId);
 
-        return result;
+        if (insertedTrackIds.contains(onePendingTrack.mTrackId)) {
+            updateTrackOrigin(onePendingTrack.mTrackId, onePendingTrack.mTrack.resourceURI(),
+                              onePendingTrack.mTrack.fileSize(), onePendingTrack.mTrack.fileModifiedTime());
+        }
     }
+}
 
-    if (d->mSelectTracksMappingPriority.next()) {
-        result = d->mSelectTracksMappingPriority.record().value(0).toInt();
+qulonglong DatabaseInterface::batchArtistId(const QString &name)
+{
+    auto cachedArtist = d->mBatchArtistIds.constFind(name);
+    if (cachedArtist != d->mBatchArtistIds.constEnd()) {
+        return cachedArtist.value();
     }
 
-    d->mSelectTracksMappingPriority.finish();
+    auto result = insertArtist(name);
+
+    if (result != 0) {
+        d->mBatchArtistIds[name] = result;
+    }
 
     return result;
 }
 
-void DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrack, const QHash<QString, QUrl> &covers, int originTrackId, QSet<qulonglong> &modifiedAlbumIds)
+qulonglong DatabaseInterface::batchAlbumId(const QString &title, const QString &albumArtist, const QUrl &albumArtURI)
 {
-    if (oneTrack.albumArtist().isEmpty()) {
-        return;
+    const auto albumKey = qMakePair(title, albumArtist);
+
+    auto cachedAlbum = d->mBatchAlbumIds.constFind(albumKey);
+    if (cachedAlbum != d->mBatchAlbumIds.constEnd()) {
+        return cachedAlbum.value();
     }
 
-    auto albumId = insertAlbum(oneTrack.albumName(), oneTrack.albumArtist(), covers[oneTrack.albumName()], 0, true);
+    auto result = insertAlbum(title, albumArtist, albumArtURI, 0, true);
 
-    auto otherTrackId = internalTrackIdFromTitleAlbumArtist(oneTrack.title(), oneTrack.albumName(), oneTrack.artist());
-    bool isModifiedTrack = otherTrackId != 0;
+    if (result != 0) {
+        d->mBatchAlbumIds[albumKey] = result;
+    }
 
-    if (isModifiedTrack) {
-        originTrackId = otherTrackId;
+    return result;
+}
 
-        removeTrackInDatabase(originTrackId);
-    } else {
-        originTrackId = d->mTrackId;
+void DatabaseInterface::clearInsertBatch()
+{
+    d->mBatchArtistIds.clear();
+    d->mBatchAlbumIds.clear();
+    d->mPendingTracks.clear();
+    d->mPendingTracksIndex.clear();
+}
+
+void DatabaseInterface::publishChanges()
+{
+    auto addedArtists = QList<MusicArtist>();
+    auto addedAlbums = QList<MusicAlbum>();
+    auto modifiedAlbums = QList<MusicAlbum>();
+
+    const auto addedAlbumIds = d->mPendingAddedAlbumIds.toSet();
+    const auto addedTrackIds = d->mPendingAddedTrackIds.toSet();
+    auto removedTrackIds = QSet<qulonglong>();
+    for (const auto &oneTrack : d->mPendingRemovedTracks) {
+        removedTrackIds.insert(oneTrack.databaseId());
     }
 
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":trackId"), originTrackId);
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":title"), oneTrack.title());
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":album"), albumId);
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":artistId"), insertArtist(oneTrack.artist()));
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":trackNumber"), oneTrack.trackNumber());
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":discNumber"), oneTrack.discNumber());
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":trackDuration"), QVariant::fromValue<qlonglong>(oneTrack.duration().msecsSinceStartOfDay()));
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":trackRating"), oneTrack.rating());
+    if (!d->mPendingAddedArtistIds.isEmpty() || !d->mPendingAddedAlbumIds.isEmpty() || !d->mPendingModifiedAlbumIds.isEmpty()) {
+        auto transactionResult = startTransaction();
+        if (!transactionResult) {
+            clearChanges();
+            return;
+        }
+
+        for (auto oneArtistId : d->mPendingAddedArtistIds) {
+            auto oneArtist = internalArtistFromId(oneArtistId);
+            if (oneArtist.isValid()) {
+                addedArtists.push_back(oneArtist);
+            }
+        }
 
-    auto result = d->mInsertTrackQuery.exec();
+        for (auto oneAlbumId : d->mPendingAddedAlbumIds) {
+            auto oneAlbum = internalAlbumFromId(oneAlbumId);
+            if (oneAlbum.isValid()) {
+                addedAlbums.push_back(oneAlbum);
+            }
+        }
 
-    if (result && d->mInsertTrackQuery.isActive()) {
-        d->mInsertTrackQuery.finish();
+        for (auto oneAlbumId : d->mPendingModifiedAlbumIds) {
+            if (addedAlbumIds.contains(oneAlbumId)) {
+                continue;
+            }
 
-        if (!isModifiedTrack) {
-            ++d->mTrackId;
+            auto oneAlbum = internalAlbumWithTracksFromId(oneAlbumId);
+            if (oneAlbum.isValid()) {
+                modifiedAlbums.push_back(oneAlbum);
+            }
         }
 
-        updateTrackOrigin(originTrackId, oneTrack.resourceURI());
+        transactionResult = finishTransaction();
+        if (!transactionResult) {
+            clearChanges();
+            return;
+        }
+    }
 
-        if (isModifiedTrack) {
-            Q_EMIT trackModified(originTrackId);
-            modifiedAlbumIds.insert(albumId);
-        } else {
-            Q_EMIT trackAdded(originTrackId);
+    auto addedTracks = QList<qulonglong>();
+    for (auto oneTrackId : d->mPendingAddedTrackIds) {
+        if (!removedTrackIds.contains(oneTrackId)) {
+            addedTracks.push_back(oneTrackId);
         }
+    }
 
-        updateIsSingleDiscAlbumFromId(albumId);
-        if (updateTracksCount(albumId)) {
-            modifiedAlbumIds.insert(albumId);
+    auto modifiedTracks = QList<qulonglong>();
+    for (auto oneTrackId : d->mPendingModifiedTrackIds) {
+        if (!addedTrackIds.contains(oneTrackId) && !removedTrackIds.contains(oneTrackId)) {
+            modifiedTracks.push_back(oneTrackId);
         }
-    } else {
-        d->mInsertTrackQuery.finish();
+    }
+
+    const auto removedTracks = d->mPendingRemovedTracks;
+    const auto removedAlbums = d->mPendingRemovedAlbums;
+    const auto removedArtists = d->mPendingRemovedArtists;
+
+    clearChanges();
 
-        qDebug() << "DatabaseInterface::modifyTracksList" << d->mInsertTrackQuery.lastQuery();
-        qDebug() << "DatabaseInterface::modifyTracksList" << d->mInsertTrackQuery.boundValues();
-        qDebug() << "DatabaseInterface::modifyTracksList" << d->mInsertTrackQuery.lastError();
+    if (!addedArtists.isEmpty()) {
+        Q_EMIT artistsAdded(addedArtists);
     }
+
+    if (!addedAlbums.isEmpty()) {
+        Q_EMIT albumsAdded(addedAlbums);
+    }
+
+    if (!addedTracks.isEmpty()) {
+        Q_EMIT tracksAdded(addedTracks);
+    }
+
+    if (!modifiedTracks.isEmpty()) {
+        Q_EMIT tracksModified(modifiedTracks);
+    }
+
+    if (!modifiedAlbums.isEmpty()) {
+        Q_EMIT albumsModified(modifiedAlbums);
+    }
+
+    if (!removedTracks.isEmpty()) {
+        Q_EMIT tracksRemoved(removedTracks);
+    }
+
+    if (!removedAlbums.isEmpty()) {
+        Q_EMIT albumsRemoved(removedAlbums);
+    }
+
+    if (!removedArtists.isEmpty()) {
+        Q_EMIT artistsRemoved(removedArtists);
+    }
+}
+
+void DatabaseInterface::clearChanges()
+{
+    d->mPendingAddedArtistIds.clear();
+    d->mPendingAddedAlbumIds.clear();
+    d->mPendingAddedTrackIds.clear();
+    d->mPendingModifiedAlbumIds.clear();
+    d->mPendingModifiedTrackIds.clear();
+    d->mPendingRemovedArtists.clear();
+    d->mPendingRemovedAlbums.clear();
+    d->mPendingRemovedTracks.clear();
 }
 
 qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
@@ -1987,24 +3652,78 @@ void DatabaseInterface::reloadExistingDatabase()
         return;
     }
 
-    const auto restoredArtists = allArtists();
-    for (const auto &oneArtist : restoredArtists) {
-        d->mArtistId = std::max(d->mArtistId, oneArtist.databaseId());
-        Q_EMIT artistAdded(oneArtist);
-    }
-    ++d->mArtistId;
+    auto lastArtistSortKey = QStringLiteral("");
+    auto lastArtistId = qulonglong(0);
+    auto lastAlbumSortKey = QStringLiteral("");
+    auto lastAlbumId = qulonglong(0);
+    auto hasMoreArtists = true;
+    auto hasMoreAlbums = true;
+
+    while ((hasMoreArtists || hasMoreAlbums) && d->mStopRequest == 0) {
+        transactionResult = startTransaction();
+        if (!transactionResult) {
+            return;
+        }
+
+        auto restoredArtists = QList<MusicArtist>();
+        if (hasMoreArtists) {
+            restoredArtists = internalArtistsPage(lastArtistSortKey, lastArtistId);
+            hasMoreArtists = restoredArtists.size() == d->mRestoreBatchSize;
+        }
+
+        auto restoredAlbums = QList<MusicAlbum>();
+        if (hasMoreAlbums) {
+            restoredAlbums = internalAlbumsPage(lastAlbumSortKey, lastAlbumId);
+            hasMoreAlbums = restoredAlbums.size() == d->mRestoreBatchSize;
+        }
+
+        transactionResult = finishTransaction();
+        if (!transactionResult) {
+            return;
+        }
 
-    const auto restoredAlbums = allAlbums();
-    for (const auto &oneAlbum : restoredAlbums) {
-        d->mAlbumId = std::max(d->mAlbumId, oneAlbum.databaseId());
-        Q_EMIT albumAdded(oneAlbum);
+        if (!restoredArtists.isEmpty()) {
+            for (const auto &oneArtist : restoredArtists) {
+                d->mArtistId = std::max(d->mArtistId, oneArtist.databaseId());
+            }
+
+            Q_EMIT artistsAdded(restoredArtists);
+        }
+
+        if (!restoredAlbums.isEmpty()) {
+            for (const auto &oneAlbum : restoredAlbums) {
+                d->mAlbumId = std::max(d->mAlbumId, oneAlbum.databaseId());
+            }
+
+            Q_EMIT albumsAdded(restoredAlbums);
+        }
     }
+    ++d->mArtistId;
     ++d->mAlbumId;
 
-    const auto restoredTracks = allTracks();
-    for (const auto &oneTrack : restoredTracks) {
-        d->mTrackId = std::max(d->mTrackId, oneTrack.databaseId());
-        Q_EMIT trackAdded(oneTrack.databaseId());
+    auto lastTrackId = qulonglong(0);
+    auto hasMoreTracks = true;
+
+    while (hasMoreTracks && d->mStopRequest == 0) {
+        transactionResult = startTransaction();
+        if (!transactionResult) {
+            return;
+        }
+
+        const auto restoredTracks = internalTracksIdPage(lastTrackId);
+        hasMoreTracks = restoredTracks.size() == d->mRestoreBatchSize;
+
+        transactionResult = finishTransaction();
+        if (!transactionResult) {
+            return;
+        }
+
+        if (!restoredTracks.isEmpty()) {
+            lastTrackId = restoredTracks.last();
+            d->mTrackId = std::max(d->mTrackId, lastTrackId);
+
+            Q_EMIT tracksAdded(restoredTracks);
+        }
     }
     ++d->mTrackId;
 }
@@ -2097,11 +3816,264 @@ QList<MusicAudioTrack> DatabaseInterface::fetchTracks(qulonglong albumId)
 
     d->mSelectTrackQuery.finish();
 
-    updateTracksCount(albumId);
-
     return allTracks;
 }
 
+void DatabaseInterface::internalAlbumTracksSummary(MusicAlbum &album, const QSqlRecord &albumRecord, int firstColumn) const
+{
+    const auto separator = QChar(31);
+
+    auto allArtists = albumRecord.value(firstColumn).toString().split(separator, QString::SkipEmptyParts);
+    std::sort(allArtists.begin(), allArtists.end());
+    allArtists.erase(std::unique(allArtists.begin(), allArtists.end()), allArtists.end());
+
+    auto allTracksTitle = albumRecord.value(firstColumn + 1).toString().split(separator, QString::SkipEmptyParts);
+    std::sort(allTracksTitle.begin(), allTracksTitle.end());
+    allTracksTitle.erase(std::unique(allTracksTitle.begin(), allTracksTitle.end()), allTracksTitle.end());
+
+    album.setAllArtists(allArtists);
+    album.setAllTracksTitle(allTracksTitle);
+    album.setHighestTrackRating(albumRecord.value(firstColumn + 2).toInt());
+}
+
+QList<MusicAlbum> DatabaseInterface::internalAlbumsFromQuery(QSqlQuery &albumsQuery)
+{
+    auto result = QList<MusicAlbum>();
+
+    auto currentAlbum = MusicAlbum();
+    auto currentAlbumTracks = QList<MusicAudioTrack>();
+
+    while(albumsQuery.next()) {
+        const auto &currentRecord = albumsQuery.record();
+
+        const auto albumId = currentRecord.value(0).toULongLong();
+
+        if (!currentAlbum.isValid() || currentAlbum.databaseId() != albumId) {
+            if (currentAlbum.isValid()) {
+                currentAlbum.setTracks(currentAlbumTracks);
+                result.push_back(currentAlbum);
+            }
+
+            currentAlbum = MusicAlbum();
+            currentAlbumTracks.clear();
+
+            currentAlbum.setDatabaseId(albumId);
+            currentAlbum.setTitle(currentRecord.value(1).toString());
+            currentAlbum.setId(currentRecord.value(2).toString());
+            currentAlbum.setArtist(currentRecord.value(3).toString());
+            currentAlbum.setAlbumArtURI(currentRecord.value(4).toUrl());
+            currentAlbum.setTracksCount(currentRecord.value(5).toInt());
+            currentAlbum.setIsSingleDiscAlbum(currentRecord.value(6).toBool());
+            currentAlbum.setValid(true);
+        }
+
+        if (currentRecord.isNull(10)) {
+            continue;
+        }
+
+        MusicAudioTrack newTrack;
+
+        newTrack.setDatabaseId(currentRecord.value(7).toULongLong());
+        newTrack.setTitle(currentRecord.value(8).toString());
+        newTrack.setParentId(currentRecord.value(0).toString());
+        newTrack.setArtist(currentRecord.value(9).toString());
+        newTrack.setAlbumName(currentAlbum.title());
+        newTrack.setAlbumArtist(currentAlbum.artist());
+        newTrack.setAlbumCover(currentAlbum.albumArtURI());
+        newTrack.setResourceURI(currentRecord.value(10).toUrl());
+        newTrack.setTrackNumber(currentRecord.value(11).toInt());
+        newTrack.setDiscNumber(currentRecord.value(12).toInt());
+        newTrack.setDuration(QTime::fromMSecsSinceStartOfDay(currentRecord.value(13).toInt()));
+        newTrack.setRating(currentRecord.value(14).toInt());
+        newTrack.setValid(true);
+
+        currentAlbumTracks.push_back(newTrack);
+    }
+
+    if (currentAlbum.isValid()) {
+        currentAlbum.setTracks(currentAlbumTracks);
+        result.push_back(currentAlbum);
+    }
+
+    return result;
+}
+
+QList<MusicArtist> DatabaseInterface::internalArtistsPage(QString &lastArtistSortKey, qulonglong &lastArtistId)
+{
+    auto result = QList<MusicArtist>();
+
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":lastSortKey"), lastArtistSortKey);
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":lastId"), lastArtistId);
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":batchSize"), d->mRestoreBatchSize);
+
+    auto queryResult = d->mSelectArtistsPageQuery.exec();
+
+    if (!queryResult || !d->mSelectArtistsPageQuery.isSelect() || !d->mSelectArtistsPageQuery.isActive()) {
+        qDebug() << "DatabaseInterface::internalArtistsPage" << d->mSelectArtistsPageQuery.lastQuery();
+        qDebug() << "DatabaseInterface::internalArtistsPage" << d->mSelectArtistsPageQuery.boundValues();
+        qDebug() << "DatabaseInterface::internalArtistsPage" << d->mSelectArtistsPageQuery.lastError();
+
+        d->mSelectArtistsPageQuery.finish();
+
+        return result;
+    }
+
+    while(d->mSelectArtistsPageQuery.next()) {
+        auto newArtist = MusicArtist();
+
+        const auto &currentRecord = d->mSelectArtistsPageQuery.record();
+
+        newArtist.setDatabaseId(currentRecord.value(0).toULongLong());
+        newArtist.setName(currentRecord.value(1).toString());
+        newArtist.setAlbumsCount(currentRecord.value(2).toInt());
+        newArtist.setValid(true);
+
+        lastArtistSortKey = currentRecord.value(3).toString();
+        lastArtistId = newArtist.databaseId();
+
+        result.push_back(newArtist);
+    }
+
+    d->mSelectArtistsPageQuery.finish();
+
+    return result;
+}
+
+QList<MusicAlbum> DatabaseInterface::internalAlbumsPage(QString &lastAlbumSortKey, qulonglong &lastAlbumId)
+{
+    auto result = QList<MusicAlbum>();
+
+    d->mSelectAlbumsPageQuery.bindValue(QStringLiteral(":lastSortKey"), lastAlbumSortKey);
+    d->mSelectAlbumsPageQuery.bindValue(QStringLiteral(":lastId"), lastAlbumId);
+    d->mSelectAlbumsPageQuery.bindValue(QStringLiteral(":batchSize"), d->mRestoreBatchSize);
+
+    auto queryResult = d->mSelectAlbumsPageQuery.exec();
+
+    if (!queryResult || !d->mSelectAlbumsPageQuery.isSelect() || !d->mSelectAlbumsPageQuery.isActive()) {
+        qDebug() << "DatabaseInterface::internalAlbumsPage" << d->mSelectAlbumsPageQuery.lastQuery();
+        qDebug() << "DatabaseInterface::internalAlbumsPage" << d->mSelectAlbumsPageQuery.boundValues();
+        qDebug() << "DatabaseInterface::internalAlbumsPage" << d->mSelectAlbumsPageQuery.lastError();
+
+        d->mSelectAlbumsPageQuery.finish();
+
+        return result;
+    }
+
+    while(d->mSelectAlbumsPageQuery.next()) {
+        const auto &currentRecord = d->mSelectAlbumsPageQuery.record();
+
+        result.push_back(internalAlbumFromPageRecord(currentRecord));
+
+        lastAlbumSortKey = currentRecord.value(10).toString();
+        lastAlbumId = result.last().databaseId();
+    }
+
+    d->mSelectAlbumsPageQuery.finish();
+
+    return result;
+}
+
+MusicAlbum DatabaseInterface::internalAlbumFromPageRecord(const QSqlRecord &albumRecord)
+{
+    auto newAlbum = MusicAlbum();
+
+    newAlbum.setDatabaseId(albumRecord.value(0).toULongLong());
+    newAlbum.setTitle(albumRecord.value(1).toString());
+    newAlbum.setId(albumRecord.value(2).toString());
+    newAlbum.setArtist(albumRecord.value(3).toString());
+    newAlbum.setAlbumArtURI(albumRecord.value(4).toUrl());
+    newAlbum.setTracksCount(albumRecord.value(5).toInt());
+    newAlbum.setIsSingleDiscAlbum(albumRecord.value(6).toBool());
+    newAlbum.setIsTracksLoaded(false);
+    internalAlbumTracksSummary(newAlbum, albumRecord, 7);
+    newAlbum.setValid(true);
+
+    return newAlbum;
+}
+
+QString DatabaseInterface::searchMatchExpression(const QString &searchText) const
+{
+    auto result = QString();
+
+    const auto allWords = searchText.split(QRegularExpression(QStringLiteral("\\s+")), QString::SkipEmptyParts);
+
+    if (allWords.isEmpty()) {
+        return result;
+    }
+
+    if (!d->mHasSearchIndex) {
+        result = QStringLiteral("%") + searchText.trimmed() + QStringLiteral("%");
+        return result;
+    }
+
+    auto matchExpression = QStringList();
+    matchExpression.reserve(allWords.size());
+
+    for (const auto &oneWord : allWords) {
+        auto escapedWord = oneWord;
+        escapedWord.replace(QStringLiteral("\""), QStringLiteral("\"\""));
+
+        matchExpression.push_back(QStringLiteral("\"") + escapedWord + QStringLiteral("\"*"));
+    }
+
+    result = matchExpression.join(QStringLiteral(" "));
+
+    return result;
+}
+
+int DatabaseInterface::internalEntitiesCount(QSqlQuery &countQuery) const
+{
+    auto result = 0;
+
+    auto queryResult = countQuery.exec();
+
+    if (!queryResult || !countQuery.isSelect() || !countQuery.isActive()) {
+        qDebug() << "DatabaseInterface::internalEntitiesCount" << countQuery.lastQuery();
+        qDebug() << "DatabaseInterface::internalEntitiesCount" << countQuery.boundValues();
+        qDebug() << "DatabaseInterface::internalEntitiesCount" << countQuery.lastError();
+
+        countQuery.finish();
+
+        return -1;
+    }
+
+    if (countQuery.next()) {
+        result = countQuery.record().value(0).toInt();
+    }
+
+    countQuery.finish();
+
+    return result;
+}
+
+QList<qulonglong> DatabaseInterface::internalTracksIdPage(qulonglong lastTrackId)
+{
+    auto result = QList<qulonglong>();
+
+    d->mSelectTracksIdPageQuery.bindValue(QStringLiteral(":lastId"), lastTrackId);
+    d->mSelectTracksIdPageQuery.bindValue(QStringLiteral(":batchSize"), d->mRestoreBatchSize);
+
+    auto queryResult = d->mSelectTracksIdPageQuery.exec();
+
+    if (!queryResult || !d->mSelectTracksIdPageQuery.isSelect() || !d->mSelectTracksIdPageQuery.isActive()) {
+        qDebug() << "DatabaseInterface::internalTracksIdPage" << d->mSelectTracksIdPageQuery.lastQuery();
+        qDebug() << "DatabaseInterface::internalTracksIdPage" << d->mSelectTracksIdPageQuery.boundValues();
+        qDebug() << "DatabaseInterface::internalTracksIdPage" << d->mSelectTracksIdPageQuery.lastError();
+
+        d->mSelectTracksIdPageQuery.finish();
+
+        return result;
+    }
+
+    while(d->mSelectTracksIdPageQuery.next()) {
+        result.push_back(d->mSelectTracksIdPageQuery.record().value(0).toULongLong());
+    }
+
+    d->mSelectTracksIdPageQuery.finish();
+
+    return result;
+}
+
 bool DatabaseInterface::updateTracksCount(qulonglong albumId)
 {
     bool isModified = false;
@@ -2204,7 +4176,8 @@ MusicAlbum DatabaseInterface::internalAlbumFromId(qulonglong albumId)
     retrievedAlbum.setAlbumArtURI(currentRecord.value(4).toUrl());
     retrievedAlbum.setTracksCount(currentRecord.value(5).toInt());
     retrievedAlbum.setIsSingleDiscAlbum(currentRecord.value(6).toBool());
-    retrievedAlbum.setTracks(fetchTracks(albumId));
+    retrievedAlbum.setIsTracksLoaded(false);
+    internalAlbumTracksSummary(retrievedAlbum, currentRecord, 7);
     retrievedAlbum.setValid(true);
 
     d->mSelectAlbumQuery.finish();
@@ -2212,41 +4185,20 @@ MusicAlbum DatabaseInterface::internalAlbumFromId(qulonglong albumId)
     return retrievedAlbum;
 }
 
-MusicAlbum DatabaseInterface::internalAlbumFromTitle(const QString &title)
+MusicAlbum DatabaseInterface::internalAlbumWithTracksFromId(qulonglong albumId)
 {
-    auto result = MusicAlbum();
-
-    d->mSelectAlbumIdFromTitleQuery.bindValue(QStringLiteral(":title"), title);
-
-    auto queryResult = d->mSelectAlbumIdFromTitleQuery.exec();
-
-    if (!queryResult || !d->mSelectAlbumIdFromTitleQuery.isSelect() || !d->mSelectAlbumIdFromTitleQuery.isActive()) {
-        qDebug() << "DatabaseInterface::albumFromTitleAndAuthor" << d->mSelectAlbumIdFromTitleQuery.lastQuery();
-        qDebug() << "DatabaseInterface::albumFromTitleAndAuthor" << d->mSelectAlbumIdFromTitleQuery.boundValues();
-        qDebug() << "DatabaseInterface::albumFromTitleAndAuthor" << d->mSelectAlbumIdFromTitleQuery.lastError();
-
-        d->mSelectAlbumIdFromTitleQuery.finish();
-
-        return result;
-    }
-
-    if (!d->mSelectAlbumIdFromTitleQuery.next()) {
-        d->mSelectAlbumIdFromTitleQuery.finish();
+    auto retrievedAlbum = internalAlbumFromId(albumId);
 
-        return result;
+    if (retrievedAlbum.isValid()) {
+        retrievedAlbum.setTracks(fetchTracks(albumId));
     }
 
-    auto albumId = d->mSelectAlbumIdFromTitleQuery.record().value(0).toULongLong();
-    d->mSelectAlbumIdFromTitleQuery.finish();
-
-    result = internalAlbumFromId(albumId);
-
-    return result;
+    return retrievedAlbum;
 }
 
-qulonglong DatabaseInterface::internalAlbumIdFromTitle(const QString &title)
+MusicAlbum DatabaseInterface::internalAlbumFromTitle(const QString &title)
 {
-    auto result = qulonglong(0);
+    auto result = MusicAlbum();
 
     d->mSelectAlbumIdFromTitleQuery.bindValue(QStringLiteral(":title"), title);
 
@@ -2268,9 +4220,11 @@ qulonglong DatabaseInterface::internalAlbumIdFromTitle(const QString &title)
         return result;
     }
 
-    result = d->mSelectAlbumIdFromTitleQuery.record().value(0).toULongLong();
+    auto albumId = d->mSelectAlbumIdFromTitleQuery.record().value(0).toULongLong();
     d->mSelectAlbumIdFromTitleQuery.finish();
 
+    result = internalAlbumFromId(albumId);
+
     return result;
 }
 
@@ -2287,9 +4241,9 @@ MusicAudioTrack DatabaseInterface::internalTrackFromDatabaseId(qulonglong id)
     auto queryResult = d->mSelectTrackFromIdQuery.exec();
 
     if (!queryResult || !d->mSelectTrackFromIdQuery.isSelect() || !d->mSelectTrackFromIdQuery.isActive()) {
-        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectAlbumQuery.lastQuery();
-        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectAlbumQuery.boundValues();
-        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectAlbumQuery.lastError();
+        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectTrackFromIdQuery.lastQuery();
+        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectTrackFromIdQuery.boundValues();
+        qDebug() << "DatabaseInterface::internalTrackFromDatabaseId" << d->mSelectTrackFromIdQuery.lastError();
 
         d->mSelectTrackFromIdQuery.finish();
 
@@ -2305,7 +4259,7 @@ MusicAudioTrack DatabaseInterface::internalTrackFromDatabaseId(qulonglong id)
     const auto &currentRecord = d->mSelectTrackFromIdQuery.record();
 
     result.setDatabaseId(currentRecord.value(0).toULongLong());
-    result.setAlbumName(internalAlbumDataFromId(currentRecord.value(2).toULongLong(), DatabaseInterface::AlbumData::Title).toString());
+    result.setAlbumName(currentRecord.value(11).toString());
     result.setArtist(currentRecord.value(3).toString());
     result.setAlbumArtist(currentRecord.value(4).toString());
     result.setDuration(QTime::fromMSecsSinceStartOfDay(currentRecord.value(8).toLongLong()));
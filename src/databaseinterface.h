@@ -30,9 +30,13 @@
 #include <QList>
 #include <QVariant>
 #include <QUrl>
+#include <QPair>
+#include <QDateTime>
 
 class DatabaseInterfacePrivate;
 class QMutex;
+class QSqlQuery;
+class QSqlRecord;
 
 class DatabaseInterface : public QObject
 {
@@ -52,7 +56,7 @@ public:
 
     virtual ~DatabaseInterface();
 
-    Q_INVOKABLE void init(const QString &dbName, const QString &databaseFileName = {});
+    Q_INVOKABLE void init(const QString &dbName, const QString &databaseFileName = {}, int restoreBatchSize = 0);
 
     MusicAlbum albumFromTitle(const QString &title);
 
@@ -70,32 +74,48 @@ public:
 
     MusicAudioTrack trackFromDatabaseId(qulonglong id);
 
+    QList<MusicAudioTrack> tracksFromDatabaseIds(const QList<qulonglong> &ids);
+
+    QList<MusicAudioTrack> tracksKeyFromDatabaseIds(const QList<qulonglong> &ids);
+
+    QList<MusicAudioTrack> tracksFromAlbumId(qulonglong albumId);
+
     qulonglong trackIdFromTitleAlbumArtist(const QString &title, const QString &album, const QString &artist) const;
 
     void applicationAboutToQuit();
 
 Q_SIGNALS:
 
-    void artistAdded(const MusicArtist &newArtist);
+    void artistsAdded(const QList<MusicArtist> &newArtists);
 
-    void albumAdded(const MusicAlbum &newAlbum);
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
 
-    void trackAdded(qulonglong id);
+    void tracksAdded(const QList<qulonglong> &newTracks);
 
-    void artistRemoved(const MusicArtist &removedArtist);
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
 
-    void albumRemoved(const MusicAlbum &removedAlbum);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
-    void trackRemoved(qulonglong id);
+    void tracksRemoved(const QList<MusicAudioTrack> &removedTracks);
 
-    void artistModified(const MusicArtist &modifiedArtist);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
-    void albumModified(const MusicAlbum &modifiedAlbum);
-
-    void trackModified(qulonglong id);
+    void tracksModified(const QList<qulonglong> &modifiedTracks);
 
     void requestsInitDone();
 
+    void restoredTracks(const QString &musicSource, const QHash<QUrl, QPair<qint64, QDateTime>> &allFiles);
+
+    void librarySearchResult(const QString &searchText, const QList<qulonglong> &albumIds, const QList<qulonglong> &trackIds);
+
+    void albumsWindow(const QString &filterText, int filterRating, int albumsCount, int offset, const QList<MusicAlbum> &albums);
+
+    void artistsWindow(int artistsCount, int offset, const QList<MusicArtist> &artists);
+
+    void albumTracks(qulonglong albumId, const QList<MusicAudioTrack> &tracks);
+
+    void artistAlbums(qulonglong artistId, const QList<MusicAlbum> &albums);
+
 public Q_SLOTS:
 
     void insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
@@ -104,6 +124,18 @@ public Q_SLOTS:
 
     void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers);
 
+    void askRestoredTracks(const QString &musicSource);
+
+    void searchLibrary(const QString &searchText);
+
+    void fetchAlbumsWindow(const QString &filterText, int filterRating, int offset, int count);
+
+    void fetchArtistsWindow(int offset, int count);
+
+    void fetchAlbumTracks(qulonglong albumId);
+
+    void fetchArtistAlbums(qulonglong artistId);
+
 private:
 
     bool startTransaction() const;
@@ -114,15 +146,37 @@ private:
 
     QList<MusicAudioTrack> fetchTracks(qulonglong albumId);
 
+    void internalAlbumTracksSummary(MusicAlbum &album, const QSqlRecord &albumRecord, int firstColumn) const;
+
+    void initSortKeys(const QString &tableName, const QString &textColumnName) const;
+
+    void initFileModifiedTimes() const;
+
+    void initSearchIndex(const QStringList &listTables) const;
+
+    QList<MusicAlbum> internalAlbumsFromQuery(QSqlQuery &albumsQuery);
+
+    QList<MusicArtist> internalArtistsPage(QString &lastArtistSortKey, qulonglong &lastArtistId);
+
+    QList<MusicAlbum> internalAlbumsPage(QString &lastAlbumSortKey, qulonglong &lastAlbumId);
+
+    MusicAlbum internalAlbumFromPageRecord(const QSqlRecord &albumRecord);
+
+    int internalEntitiesCount(QSqlQuery &countQuery) const;
+
+    QString searchMatchExpression(const QString &searchText) const;
+
+    QList<qulonglong> internalTracksIdPage(qulonglong lastTrackId);
+
     bool updateTracksCount(qulonglong albumId);
 
     MusicArtist internalArtistFromId(qulonglong artistId) const;
 
     MusicAlbum internalAlbumFromId(qulonglong albumId);
 
-    MusicAlbum internalAlbumFromTitle(const QString &title);
+    MusicAlbum internalAlbumWithTracksFromId(qulonglong albumId);
 
-    qulonglong internalAlbumIdFromTitle(const QString &title);
+    MusicAlbum internalAlbumFromTitle(const QString &title);
 
     MusicAudioTrack internalTrackFromDatabaseId(qulonglong id);
 
@@ -156,13 +210,28 @@ private:
 
     qulonglong insertMusicSource(const QString &name);
 
-    void insertTrackOrigin(const QUrl &fileNameURI, qulonglong discoverId);
+    void insertTrackOrigin(const QUrl &fileNameURI, qint64 fileSize, const QDateTime &fileModifiedTime, qulonglong discoverId);
+
+    void updateTrackOrigin(qulonglong trackId, const QUrl &fileName, qint64 fileSize, const QDateTime &fileModifiedTime);
+
+    void internalInsertTrack(const MusicAudioTrack &oneTrack, const QHash<QString, QUrl> &covers,
+                             qulonglong discoverId, QSet<qulonglong> &insertedAlbumIds);
+
+    void flushPendingTracks(QSet<qulonglong> &modifiedAlbumIds);
+
+    void resolvePendingTracksIds();
+
+    void updatePendingTracksOrigin(const QSet<qulonglong> &insertedTrackIds);
+
+    qulonglong batchArtistId(const QString &name);
+
+    qulonglong batchAlbumId(const QString &title, const QString &albumArtist, const QUrl &albumArtURI);
 
-    void updateTrackOrigin(qulonglong trackId, const QUrl &fileName);
+    void clearInsertBatch();
 
-    int computeTrackPriority(qulonglong trackId, const QUrl &fileName);
+    void publishChanges();
 
-    void internalInsertTrack(const MusicAudioTrack &oneModifiedTrack, const QHash<QString, QUrl> &covers, int originTrackId, QSet<qulonglong> &modifiedAlbumIds);
+    void clearChanges();
 
     DatabaseInterfacePrivate *d;
 
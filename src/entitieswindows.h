@@ -0,0 +1,220 @@
+/*
+ * Copyright 2017 Elisa contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef ENTITIESWINDOWS_H
+#define ENTITIESWINDOWS_H
+
+#include <QVector>
+#include <QList>
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
+
+// Rows of a database backed model, held as a few fixed size windows; the
+// least recently used windows are dropped and fetched again when needed.
+template <typename Entity>
+class EntitiesWindows
+{
+public:
+
+    int windowSize() const
+    {
+        return mWindowSize;
+    }
+
+    int entitiesCount() const
+    {
+        return mEntitiesCount;
+    }
+
+    void setEntitiesCount(int entitiesCount)
+    {
+        mEntitiesCount = entitiesCount;
+    }
+
+    bool hasWantedWindows() const
+    {
+        return !mWantedWindows.isEmpty();
+    }
+
+    void clear()
+    {
+        mEntitiesCount = 0;
+
+        mWindows.clear();
+        mRecentWindows.clear();
+        mPendingWindows.clear();
+        mWantedWindows.clear();
+        mStaleWindows.clear();
+    }
+
+    const Entity* entityFromRow(int row)
+    {
+        const auto windowIndex = row / mWindowSize;
+        const auto rowInWindow = row % mWindowSize;
+
+        if (rowInWindow < mWindowSize / 4 && windowIndex > 0) {
+            wantWindow(windowIndex - 1);
+        } else if (rowInWindow >= mWindowSize - mWindowSize / 4) {
+            wantWindow(windowIndex + 1);
+        }
+
+        const auto windowIterator = mWindows.constFind(windowIndex);
+
+        if (windowIterator == mWindows.constEnd()) {
+            wantWindow(windowIndex);
+            return nullptr;
+        }
+
+        if (mRecentWindows.last() != windowIndex) {
+            mRecentWindows.removeOne(windowIndex);
+            mRecentWindows.push_back(windowIndex);
+        }
+
+        if (rowInWindow >= windowIterator->size()) {
+            return nullptr;
+        }
+
+        return &(*windowIterator)[rowInWindow];
+    }
+
+    void wantWindow(int windowIndex)
+    {
+        if (windowIndex * mWindowSize >= std::max(mEntitiesCount, mWindowSize)) {
+            return;
+        }
+
+        if (mWindows.contains(windowIndex) || mPendingWindows.contains(windowIndex)) {
+            return;
+        }
+
+        mWantedWindows.insert(windowIndex);
+    }
+
+    QList<int> takeWantedWindows()
+    {
+        auto result = QList<int>();
+        result.reserve(mWantedWindows.size());
+
+        for (auto windowIndex : mWantedWindows) {
+            mPendingWindows.insert(windowIndex);
+            result.push_back(windowIndex);
+        }
+
+        mWantedWindows.clear();
+
+        return result;
+    }
+
+    void cancelWindow(int windowIndex)
+    {
+        mPendingWindows.remove(windowIndex);
+    }
+
+    void refreshWindows()
+    {
+        if (mWindows.isEmpty()) {
+            mWantedWindows.insert(0);
+        }
+
+        for (auto windowIterator = mWindows.constBegin(); windowIterator != mWindows.constEnd(); ++windowIterator) {
+            mStaleWindows.insert(windowIterator.key());
+            mWantedWindows.insert(windowIterator.key());
+        }
+    }
+
+    void refreshOtherWindows(int windowIndex)
+    {
+        for (auto windowIterator = mWindows.constBegin(); windowIterator != mWindows.constEnd(); ++windowIterator) {
+            if (windowIterator.key() != windowIndex && !mStaleWindows.contains(windowIterator.key())) {
+                mStaleWindows.insert(windowIterator.key());
+                mWantedWindows.insert(windowIterator.key());
+            }
+        }
+    }
+
+    void setWindow(int windowIndex, const QList<Entity> &entities)
+    {
+        mPendingWindows.remove(windowIndex);
+        mStaleWindows.remove(windowIndex);
+
+        mWindows[windowIndex] = entities.toVector();
+        mRecentWindows.removeOne(windowIndex);
+        mRecentWindows.push_back(windowIndex);
+
+        while (mRecentWindows.size() > mMaximumWindowsCount) {
+            const auto evictedWindow = mRecentWindows.takeFirst();
+
+            mWindows.remove(evictedWindow);
+            mStaleWindows.remove(evictedWindow);
+        }
+    }
+
+    QVector<int> replaceEntities(const QList<Entity> &modifiedEntities)
+    {
+        auto modifiedRows = QVector<int>();
+        modifiedRows.reserve(modifiedEntities.size());
+
+        auto modifiedIds = QHash<qulonglong, int>();
+        modifiedIds.reserve(modifiedEntities.size());
+
+        for (int entityIndex = 0; entityIndex < modifiedEntities.size(); ++entityIndex) {
+            modifiedIds[modifiedEntities[entityIndex].databaseId()] = entityIndex;
+        }
+
+        for (auto windowIterator = mWindows.begin(); windowIterator != mWindows.end(); ++windowIterator) {
+            auto &windowEntities = windowIterator.value();
+
+            for (int rowInWindow = 0; rowInWindow < windowEntities.size(); ++rowInWindow) {
+                const auto modifiedIterator = modifiedIds.constFind(windowEntities[rowInWindow].databaseId());
+
+                if (modifiedIterator == modifiedIds.constEnd()) {
+                    continue;
+                }
+
+                windowEntities[rowInWindow] = modifiedEntities[modifiedIterator.value()];
+                modifiedRows.push_back(windowIterator.key() * mWindowSize + rowInWindow);
+            }
+        }
+
+        return modifiedRows;
+    }
+
+private:
+
+    QHash<int, QVector<Entity>> mWindows;
+
+    QList<int> mRecentWindows;
+
+    QSet<int> mPendingWindows;
+
+    QSet<int> mWantedWindows;
+
+    QSet<int> mStaleWindows;
+
+    int mEntitiesCount = 0;
+
+    const int mWindowSize = 100;
+
+    const int mMaximumWindowsCount = 10;
+
+};
+
+#endif // ENTITIESWINDOWS_H
@@ -25,7 +25,8 @@
 
 ManageAudioPlayer::ManageAudioPlayer(QObject *parent) : QObject(parent)
 {
-
+    mPositionTimer.setInterval(mPositionUpdateInterval);
+    connect(&mPositionTimer, &QTimer::timeout, this, &ManageAudioPlayer::publishPlayerPosition);
 }
 
 QPersistentModelIndex ManageAudioPlayer::currentTrack() const
@@ -33,6 +34,11 @@ QPersistentModelIndex ManageAudioPlayer::currentTrack() const
     return mCurrentTrack;
 }
 
+QPersistentModelIndex ManageAudioPlayer::nextTrack() const
+{
+    return mNextTrack;
+}
+
 QAbstractItemModel *ManageAudioPlayer::playListModel() const
 {
     return mPlayListModel;
@@ -57,6 +63,15 @@ QUrl ManageAudioPlayer::playerSource() const
     return mCurrentTrack.data(mUrlRole).toUrl();
 }
 
+QUrl ManageAudioPlayer::nextPlayerSource() const
+{
+    if (!mNextTrack.isValid()) {
+        return QUrl();
+    }
+
+    return mNextTrack.data(mUrlRole).toUrl();
+}
+
 int ManageAudioPlayer::playerStatus() const
 {
     return mPlayerStatus;
@@ -89,7 +104,22 @@ int ManageAudioPlayer::playerPosition() const
 
 int ManageAudioPlayer::playControlPosition() const
 {
-    return mPlayerPosition;
+    return mPublishedPlayerPosition;
+}
+
+int ManageAudioPlayer::positionUpdateInterval() const
+{
+    return mPositionUpdateInterval;
+}
+
+bool ManageAudioPlayer::positionUpdatesEnabled() const
+{
+    return mPositionUpdatesEnabled;
+}
+
+int ManageAudioPlayer::trackSwitchLatency() const
+{
+    return mTrackSwitchLatency;
 }
 
 QVariantMap ManageAudioPlayer::persistentState() const
@@ -119,6 +149,7 @@ void ManageAudioPlayer::setCurrentTrack(const QPersistentModelIndex &currentTrac
 
     mOldCurrentTrack = mCurrentTrack;
     mCurrentTrack = currentTrack;
+    mNextTrackRequested = false;
     Q_EMIT currentTrackChanged();
 
     switch (mPlayerPlaybackState) {
@@ -133,6 +164,17 @@ void ManageAudioPlayer::setCurrentTrack(const QPersistentModelIndex &currentTrac
     }
 }
 
+void ManageAudioPlayer::setNextTrack(const QPersistentModelIndex &nextTrack)
+{
+    if (mNextTrack == nextTrack) {
+        return;
+    }
+
+    mNextTrack = nextTrack;
+    Q_EMIT nextTrackChanged();
+    Q_EMIT nextPlayerSourceChanged();
+}
+
 void ManageAudioPlayer::setPlayListModel(QAbstractItemModel *aPlayListModel)
 {
     if (mPlayListModel == aPlayListModel) {
@@ -206,6 +248,7 @@ void ManageAudioPlayer::setPlayerStatus(int playerStatus)
     case Buffered:
         break;
     case EndOfMedia:
+        mTrackSwitchTimer.start();
         break;
     case InvalidMedia:
         break;
@@ -227,6 +270,8 @@ void ManageAudioPlayer::setPlayerPlaybackState(int playerPlaybackState)
     mPlayerPlaybackState = static_cast<PlayerPlaybackState>(playerPlaybackState);
     Q_EMIT playerPlaybackStateChanged();
 
+    updatePositionTimer();
+
     if (!mSkippingCurrentTrack) {
         switch(mPlayerPlaybackState) {
         case StoppedState:
@@ -249,6 +294,7 @@ void ManageAudioPlayer::setPlayerPlaybackState(int playerPlaybackState)
             if (mPlayListModel && mCurrentTrack.isValid()) {
                 mPlayListModel->setData(mCurrentTrack, MediaPlayList::IsPlaying, mIsPlayingRole);
             }
+            notifyTrackSwitchLatency();
             break;
         case PausedState:
             if (mPlayListModel && mCurrentTrack.isValid()) {
@@ -277,6 +323,7 @@ void ManageAudioPlayer::setPlayerPlaybackState(int playerPlaybackState)
             if (mPlayListModel && mCurrentTrack.isValid()) {
                 mPlayListModel->setData(mCurrentTrack, MediaPlayList::IsPlaying, mIsPlayingRole);
             }
+            notifyTrackSwitchLatency();
             break;
         case PausedState:
             if (mPlayListModel && mCurrentTrack.isValid()) {
@@ -372,15 +419,52 @@ void ManageAudioPlayer::setPlayerPosition(int playerPosition)
     }
 
     mPlayerPosition = playerPosition;
-    Q_EMIT playerPositionChanged();
-    QTimer::singleShot(0, [this]() {Q_EMIT playControlPositionChanged();});
+
+    if (mPositionUpdatesEnabled && (!mPositionTimer.isActive() || mPositionChangedBySeek)) {
+        mPositionChangedBySeek = false;
+        publishPlayerPosition();
+    }
+
+    if (!mNextTrackRequested && mPlayerPlaybackState == PlayingState && mAudioDuration > 0 &&
+            mAudioDuration - mPlayerPosition <= mNextTrackPrerollDelay) {
+        mNextTrackRequested = true;
+        Q_EMIT prepareNextTrack();
+    }
 }
 
 void ManageAudioPlayer::setPlayControlPosition(int playerPosition)
 {
+    mPositionChangedBySeek = true;
     Q_EMIT seek(playerPosition);
 }
 
+void ManageAudioPlayer::setPositionUpdateInterval(int positionUpdateInterval)
+{
+    if (mPositionUpdateInterval == positionUpdateInterval || positionUpdateInterval <= 0) {
+        return;
+    }
+
+    mPositionUpdateInterval = positionUpdateInterval;
+    mPositionTimer.setInterval(mPositionUpdateInterval);
+    Q_EMIT positionUpdateIntervalChanged();
+}
+
+void ManageAudioPlayer::setPositionUpdatesEnabled(bool positionUpdatesEnabled)
+{
+    if (mPositionUpdatesEnabled == positionUpdatesEnabled) {
+        return;
+    }
+
+    mPositionUpdatesEnabled = positionUpdatesEnabled;
+    Q_EMIT positionUpdatesEnabledChanged();
+
+    if (mPositionUpdatesEnabled) {
+        publishPlayerPosition();
+    }
+
+    updatePositionTimer();
+}
+
 void ManageAudioPlayer::setPersistentState(const QVariantMap &persistentStateValue)
 {
     if (mPersistentState == persistentStateValue) {
@@ -394,12 +478,14 @@ void ManageAudioPlayer::setPersistentState(const QVariantMap &persistentStateVal
 
 void ManageAudioPlayer::playerSeek(int position)
 {
+    mPositionChangedBySeek = true;
     Q_EMIT seek(position);
 }
 
 void ManageAudioPlayer::playListFinished()
 {
     mPlayingState = false;
+    mTrackSwitchTimer.invalidate();
 }
 
 void ManageAudioPlayer::tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
@@ -437,6 +523,43 @@ void ManageAudioPlayer::notifyPlayerSourceProperty()
     }
 }
 
+void ManageAudioPlayer::publishPlayerPosition()
+{
+    if (mPublishedPlayerPosition == mPlayerPosition) {
+        return;
+    }
+
+    mPublishedPlayerPosition = mPlayerPosition;
+    Q_EMIT playerPositionChanged();
+    Q_EMIT playControlPositionChanged();
+}
+
+void ManageAudioPlayer::updatePositionTimer()
+{
+    if (mPositionUpdatesEnabled && mPlayerPlaybackState == PlayingState) {
+        if (!mPositionTimer.isActive()) {
+            mPositionTimer.start();
+        }
+    } else {
+        mPositionTimer.stop();
+
+        if (mPositionUpdatesEnabled) {
+            publishPlayerPosition();
+        }
+    }
+}
+
+void ManageAudioPlayer::notifyTrackSwitchLatency()
+{
+    if (!mTrackSwitchTimer.isValid()) {
+        return;
+    }
+
+    mTrackSwitchLatency = static_cast<int>(mTrackSwitchTimer.elapsed());
+    mTrackSwitchTimer.invalidate();
+    Q_EMIT trackSwitchLatencyChanged();
+}
+
 void ManageAudioPlayer::triggerPlay()
 {
     QTimer::singleShot(0, [this]() {Q_EMIT playerPlay();});
@@ -24,6 +24,8 @@
 #include <QPersistentModelIndex>
 #include <QAbstractItemModel>
 #include <QUrl>
+#include <QTimer>
+#include <QElapsedTimer>
 
 class ManageAudioPlayer : public QObject
 {
@@ -34,6 +36,11 @@ class ManageAudioPlayer : public QObject
                WRITE setCurrentTrack
                NOTIFY currentTrackChanged)
 
+    Q_PROPERTY(QPersistentModelIndex nextTrack
+               READ nextTrack
+               WRITE setNextTrack
+               NOTIFY nextTrackChanged)
+
     Q_PROPERTY(QAbstractItemModel* playListModel
                READ playListModel
                WRITE setPlayListModel
@@ -43,6 +50,10 @@ class ManageAudioPlayer : public QObject
                READ playerSource
                NOTIFY playerSourceChanged)
 
+    Q_PROPERTY(QUrl nextPlayerSource
+               READ nextPlayerSource
+               NOTIFY nextPlayerSourceChanged)
+
     Q_PROPERTY(int urlRole
                READ urlRole
                WRITE setUrlRole
@@ -88,6 +99,20 @@ class ManageAudioPlayer : public QObject
                WRITE setPlayControlPosition
                NOTIFY playControlPositionChanged)
 
+    Q_PROPERTY(int positionUpdateInterval
+               READ positionUpdateInterval
+               WRITE setPositionUpdateInterval
+               NOTIFY positionUpdateIntervalChanged)
+
+    Q_PROPERTY(bool positionUpdatesEnabled
+               READ positionUpdatesEnabled
+               WRITE setPositionUpdatesEnabled
+               NOTIFY positionUpdatesEnabledChanged)
+
+    Q_PROPERTY(int trackSwitchLatency
+               READ trackSwitchLatency
+               NOTIFY trackSwitchLatencyChanged)
+
     Q_PROPERTY(QVariantMap persistentState
                READ persistentState
                WRITE setPersistentState
@@ -132,6 +157,8 @@ public:
 
     QPersistentModelIndex currentTrack() const;
 
+    QPersistentModelIndex nextTrack() const;
+
     QAbstractItemModel* playListModel() const;
 
     int urlRole() const;
@@ -140,6 +167,8 @@ public:
 
     QUrl playerSource() const;
 
+    QUrl nextPlayerSource() const;
+
     int playerStatus() const;
 
     int playerPlaybackState() const;
@@ -154,6 +183,12 @@ public:
 
     int playControlPosition() const;
 
+    int positionUpdateInterval() const;
+
+    bool positionUpdatesEnabled() const;
+
+    int trackSwitchLatency() const;
+
     QVariantMap persistentState() const;
 
     int playListPosition() const;
@@ -162,10 +197,14 @@ Q_SIGNALS:
 
     void currentTrackChanged();
 
+    void nextTrackChanged();
+
     void playListModelChanged();
 
     void playerSourceChanged();
 
+    void nextPlayerSourceChanged();
+
     void urlRoleChanged();
 
     void isPlayingRoleChanged();
@@ -184,6 +223,8 @@ Q_SIGNALS:
 
     void skipNextTrack();
 
+    void prepareNextTrack();
+
     void audioDurationChanged();
 
     void playerIsSeekableChanged();
@@ -192,6 +233,12 @@ Q_SIGNALS:
 
     void playControlPositionChanged();
 
+    void positionUpdateIntervalChanged();
+
+    void positionUpdatesEnabledChanged();
+
+    void trackSwitchLatencyChanged();
+
     void persistentStateChanged();
 
     void seek(int position);
@@ -200,6 +247,8 @@ public Q_SLOTS:
 
     void setCurrentTrack(const QPersistentModelIndex &currentTrack);
 
+    void setNextTrack(const QPersistentModelIndex &nextTrack);
+
     void setPlayListModel(QAbstractItemModel* aPlayListModel);
 
     void setUrlRole(int value);
@@ -224,6 +273,10 @@ public Q_SLOTS:
 
     void setPlayControlPosition(int playerPosition);
 
+    void setPositionUpdateInterval(int positionUpdateInterval);
+
+    void setPositionUpdatesEnabled(bool positionUpdatesEnabled);
+
     void setPersistentState(const QVariantMap &persistentStateValue);
 
     void playerSeek(int position);
@@ -232,10 +285,18 @@ public Q_SLOTS:
 
     void tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
 
+private Q_SLOTS:
+
+    void publishPlayerPosition();
+
 private:
 
+    void updatePositionTimer();
+
     void notifyPlayerSourceProperty();
 
+    void notifyTrackSwitchLatency();
+
     void triggerPlay();
 
     void triggerPause();
@@ -248,6 +309,8 @@ private:
 
     QPersistentModelIndex mOldCurrentTrack;
 
+    QPersistentModelIndex mNextTrack;
+
     QAbstractItemModel *mPlayListModel = nullptr;
 
     int mUrlRole = Qt::DisplayRole;
@@ -272,6 +335,24 @@ private:
 
     int mPlayerPosition = 0;
 
+    int mPublishedPlayerPosition = 0;
+
+    int mPositionUpdateInterval = 1000;
+
+    bool mPositionUpdatesEnabled = true;
+
+    bool mPositionChangedBySeek = false;
+
+    QTimer mPositionTimer;
+
+    int mNextTrackPrerollDelay = 10000;
+
+    bool mNextTrackRequested = false;
+
+    QElapsedTimer mTrackSwitchTimer;
+
+    int mTrackSwitchLatency = -1;
+
     bool isFirstPlayTriggerPlay = true;
 
     bool isFirstPlayTriggerSeek = true;
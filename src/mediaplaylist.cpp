@@ -25,24 +25,159 @@
 #include <QUrl>
 #include <QPersistentModelIndex>
 #include <QList>
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <QVector>
+#include <QStringList>
 #include <QDebug>
 
 #include <algorithm>
+#include <functional>
 
 class MediaPlayListPrivate
 {
 public:
 
+    using TrackKey = QPair<QString, QPair<QString, QString>>;
+
+    static TrackKey trackKey(const QString &title, const QString &album, const QString &artist)
+    {
+        return {title, {album, artist}};
+    }
+
+    void addRowToIndex(int row)
+    {
+        const auto &oneEntry = mData[row];
+
+        if (oneEntry.mIsValid) {
+            mTrackRows[oneEntry.mId].push_back(row);
+        } else if (oneEntry.mIsArtist) {
+            mArtistRows[oneEntry.mArtist].push_back(row);
+        } else {
+            mUnresolvedRows[trackKey(oneEntry.mTitle, oneEntry.mAlbum, oneEntry.mArtist)].push_back(row);
+        }
+    }
+
+    void removeRowFromIndex(int row)
+    {
+        const auto &oneEntry = mData[row];
+
+        if (oneEntry.mIsValid) {
+            removeIndexedRow(mTrackRows, oneEntry.mId, row);
+        } else if (oneEntry.mIsArtist) {
+            removeIndexedRow(mArtistRows, oneEntry.mArtist, row);
+        } else {
+            removeIndexedRow(mUnresolvedRows, trackKey(oneEntry.mTitle, oneEntry.mAlbum, oneEntry.mArtist), row);
+        }
+    }
+
+    template <typename Key>
+    static void removeIndexedRow(QHash<Key, QVector<int>> &rowsIndex, const Key &key, int row)
+    {
+        auto rowsIterator = rowsIndex.find(key);
+
+        if (rowsIterator == rowsIndex.end()) {
+            return;
+        }
+
+        rowsIterator->removeOne(row);
+
+        if (rowsIterator->isEmpty()) {
+            rowsIndex.erase(rowsIterator);
+        }
+    }
+
+    void clearIndex()
+    {
+        mTrackRows.clear();
+        mArtistRows.clear();
+        mUnresolvedRows.clear();
+        mIndexIsDirty = false;
+    }
+
+    void ensureIndex()
+    {
+        if (!mIndexIsDirty) {
+            return;
+        }
+
+        clearIndex();
+
+        for (int row = 0; row < mData.size(); ++row) {
+            addRowToIndex(row);
+        }
+    }
+
+    QString albumName(int row) const
+    {
+        return mData[row].mIsValid ? mTrackData[row].albumName() : mData[row].mAlbum;
+    }
+
+    bool computeHasHeader(int row) const
+    {
+        if (row == 0) {
+            return true;
+        }
+
+        return albumName(row) != albumName(row - 1);
+    }
+
+    void appendHasHeader()
+    {
+        mHasHeader.push_back(computeHasHeader(mHasHeader.size()));
+    }
+
+    bool updateHasHeader(int row)
+    {
+        if (row < 0 || row >= mHasHeader.size()) {
+            return false;
+        }
+
+        const auto hasHeader = computeHasHeader(row);
+
+        if (mHasHeader[row] == hasHeader) {
+            return false;
+        }
+
+        mHasHeader[row] = hasHeader;
+
+        return true;
+    }
+
     QList<MediaPlayListEntry> mData;
 
     QList<MusicAudioTrack> mTrackData;
 
+    QVector<bool> mHasHeader;
+
+    QHash<qulonglong, QVector<int>> mTrackRows;
+
+    QHash<QString, QVector<int>> mArtistRows;
+
+    QHash<TrackKey, QVector<int>> mUnresolvedRows;
+
+    QList<qulonglong> mPendingAlbumIds;
+
+    bool mIndexIsDirty = false;
+
+    QSet<qulonglong> mRestoredTracksIds;
+
+    QList<QVariant> mPersistentState;
+
+    bool mPersistentStateIsDirty = true;
+
     MusicListenersManager* mMusicListenersManager = nullptr;
 
 };
 
 MediaPlayList::MediaPlayList(QObject *parent) : QAbstractListModel(parent), d(new MediaPlayListPrivate)
 {
+    connect(this, &MediaPlayList::rowsInserted, this, &MediaPlayList::invalidatePersistentState);
+    connect(this, &MediaPlayList::rowsRemoved, this, &MediaPlayList::invalidatePersistentState);
+    connect(this, &MediaPlayList::rowsMoved, this, &MediaPlayList::invalidatePersistentState);
+    connect(this, &MediaPlayList::dataChanged, this, &MediaPlayList::invalidatePersistentState);
+    connect(this, &MediaPlayList::modelReset, this, &MediaPlayList::invalidatePersistentState);
 }
 
 MediaPlayList::~MediaPlayList()
@@ -242,6 +377,15 @@ QHash<int, QByteArray> MediaPlayList::roleNames() const
 }
 
 bool MediaPlayList::removeRows(int row, int count, const QModelIndex &parent)
+{
+    internalRemoveRows(row, count, parent);
+
+    Q_EMIT persistentStateChanged();
+
+    return false;
+}
+
+void MediaPlayList::internalRemoveRows(int row, int count, const QModelIndex &parent)
 {
     beginRemoveRows(parent, row, row + count - 1);
 
@@ -251,20 +395,16 @@ bool MediaPlayList::removeRows(int row, int count, const QModelIndex &parent)
         hadAlbumHeader = rowHasHeader(row + count);
     }
 
-    for (int i = row, cpt = 0; cpt < count; ++i, ++cpt) {
-        d->mData.removeAt(i);
-        d->mTrackData.removeAt(i);
-    }
+    d->mData.erase(d->mData.begin() + row, d->mData.begin() + row + count);
+    d->mTrackData.erase(d->mTrackData.begin() + row, d->mTrackData.begin() + row + count);
+    d->mHasHeader.erase(d->mHasHeader.begin() + row, d->mHasHeader.begin() + row + count);
+    d->updateHasHeader(row);
+    d->mIndexIsDirty = true;
     endRemoveRows();
 
     if (hadAlbumHeader != rowHasHeader(row)) {
-        qDebug() << "dataChanged(index(row, 0), index(row, 0), {ColumnsRoles::HasAlbumHeader});" << row;
         Q_EMIT dataChanged(index(row, 0), index(row, 0), {ColumnsRoles::HasAlbumHeader});
     }
-
-    Q_EMIT persistentStateChanged();
-
-    return false;
 }
 
 void MediaPlayList::enqueue(qulonglong newTrackId)
@@ -298,6 +438,10 @@ void MediaPlayList::enqueue(const MediaPlayListEntry &newEntry, const MusicAudio
     } else {
         d->mTrackData.push_back({});
     }
+    d->appendHasHeader();
+    if (!d->mIndexIsDirty) {
+        d->addRowToIndex(d->mData.size() - 1);
+    }
     endInsertRows();
 
     Q_EMIT persistentStateChanged();
@@ -337,11 +481,27 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
             d->mData.move(sourceRow, destinationChild - 1);
             d->mTrackData.move(sourceRow, destinationChild - 1);
         } else {
-            d->mData.move(sourceRow, destinationChild);
-            d->mTrackData.move(sourceRow, destinationChild);
+            d->mData.move(sourceRow + cptItem, destinationChild + cptItem);
+            d->mTrackData.move(sourceRow + cptItem, destinationChild + cptItem);
         }
     }
 
+    if (sourceRow < destinationChild) {
+        std::rotate(d->mHasHeader.begin() + sourceRow, d->mHasHeader.begin() + sourceRow + count, d->mHasHeader.begin() + destinationChild);
+
+        d->updateHasHeader(sourceRow);
+        d->updateHasHeader(destinationChild - count);
+        d->updateHasHeader(destinationChild);
+    } else {
+        std::rotate(d->mHasHeader.begin() + destinationChild, d->mHasHeader.begin() + sourceRow, d->mHasHeader.begin() + sourceRow + count);
+
+        d->updateHasHeader(destinationChild);
+        d->updateHasHeader(destinationChild + count);
+        d->updateHasHeader(sourceRow + count);
+    }
+
+    d->mIndexIsDirty = true;
+
     endMoveRows();
 
     if (sourceRow < destinationChild) {
@@ -390,8 +550,50 @@ void MediaPlayList::move(int from, int to, int n)
 
 void MediaPlayList::enqueue(const MusicAlbum &album)
 {
-    for (auto oneTrackIndex = 0; oneTrackIndex < album.tracksCount(); ++oneTrackIndex) {
-        enqueue(album.trackFromIndex(oneTrackIndex));
+    if (!album.isTracksLoaded()) {
+        d->mPendingAlbumIds.push_back(album.databaseId());
+
+        Q_EMIT newAlbumInList(album.databaseId());
+
+        return;
+    }
+
+    enqueue(album.allTracks());
+}
+
+void MediaPlayList::enqueue(const QList<MusicAudioTrack> &newTracks)
+{
+    if (newTracks.isEmpty()) {
+        return;
+    }
+
+    const auto firstNewRow = d->mData.size();
+
+    auto newTracksIds = QList<qulonglong>();
+    newTracksIds.reserve(newTracks.size());
+
+    d->mData.reserve(firstNewRow + newTracks.size());
+    d->mTrackData.reserve(firstNewRow + newTracks.size());
+
+    beginInsertRows(QModelIndex(), firstNewRow, firstNewRow + newTracks.size() - 1);
+    for (const auto &oneTrack : newTracks) {
+        d->mData.push_back(MediaPlayListEntry(oneTrack));
+        d->mTrackData.push_back(oneTrack);
+        d->appendHasHeader();
+        if (!d->mIndexIsDirty) {
+            d->addRowToIndex(d->mData.size() - 1);
+        }
+
+        newTracksIds.push_back(oneTrack.databaseId());
+    }
+    endInsertRows();
+
+    Q_EMIT persistentStateChanged();
+
+    Q_EMIT newTracksByIdInList(newTracksIds);
+
+    for (const auto &oneTrack : newTracks) {
+        Q_EMIT trackHasBeenAdded(oneTrack.title(), oneTrack.albumCover());
     }
 }
 
@@ -400,6 +602,10 @@ void MediaPlayList::enqueue(const QString &artistName)
     beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size());
     d->mData.push_back(MediaPlayListEntry{artistName});
     d->mTrackData.push_back({});
+    d->appendHasHeader();
+    if (!d->mIndexIsDirty) {
+        d->addRowToIndex(d->mData.size() - 1);
+    }
     endInsertRows();
 
     Q_EMIT newArtistInList(artistName);
@@ -411,6 +617,12 @@ void MediaPlayList::clearAndEnqueue(const MusicAlbum &album)
     enqueue(album);
 }
 
+void MediaPlayList::clearAndEnqueue(const QList<MusicAudioTrack> &newTracks)
+{
+    clearPlayList();
+    enqueue(newTracks);
+}
+
 void MediaPlayList::clearAndEnqueue(const QString &artistName)
 {
     clearPlayList();
@@ -422,28 +634,34 @@ void MediaPlayList::clearPlayList()
     beginRemoveRows({}, 0, d->mData.count());
     d->mData.clear();
     d->mTrackData.clear();
+    d->mHasHeader.clear();
+    d->clearIndex();
+    d->mPendingAlbumIds.clear();
     endRemoveRows();
 }
 
 QList<QVariant> MediaPlayList::persistentState() const
 {
-    auto result = QList<QVariant>();
+    if (!d->mPersistentStateIsDirty) {
+        return d->mPersistentState;
+    }
+
+    d->mPersistentState.clear();
+    d->mPersistentState.reserve(d->mData.size());
 
     for (int trackIndex = 0; trackIndex < d->mData.size(); ++trackIndex) {
-        auto oneData = QList<QString>();
         const auto &oneEntry = d->mData[trackIndex];
         if (oneEntry.mIsValid) {
             const auto &oneTrack = d->mTrackData[trackIndex];
 
-            oneData.push_back(oneTrack.title());
-            oneData.push_back(oneTrack.albumName());
-            oneData.push_back(oneTrack.artist());
-
-            result.push_back(QVariant(oneData));
+            d->mPersistentState.push_back(QStringList({oneTrack.title(), oneTrack.albumName(), oneTrack.artist(),
+                                                       QString::number(oneTrack.databaseId())}));
         }
     }
 
-    return result;
+    d->mPersistentStateIsDirty = false;
+
+    return d->mPersistentState;
 }
 
 MusicListenersManager *MediaPlayList::musicListenersManager() const
@@ -453,120 +671,264 @@ MusicListenersManager *MediaPlayList::musicListenersManager() const
 
 void MediaPlayList::setPersistentState(const QList<QVariant> &persistentState)
 {
-    qDebug() << "MediaPlayList::setPersistentState" << persistentState;
+    auto restoredEntries = QList<MediaPlayListEntry>();
+    restoredEntries.reserve(persistentState.size());
 
     for (auto &oneData : persistentState) {
         auto trackData = oneData.toStringList();
-        if (trackData.size() != 3) {
+        if (trackData.size() != 3 && trackData.size() != 4) {
             continue;
         }
 
-        auto restoredTitle = trackData[0];
-        auto restoredAlbum = trackData[1];
-        auto restoredArtist = trackData[2];
+        auto newEntry = MediaPlayListEntry(trackData[0], trackData[1], trackData[2]);
+
+        if (trackData.size() == 4) {
+            newEntry.mId = trackData[3].toULongLong();
+        }
+
+        restoredEntries.push_back(newEntry);
+    }
+
+    if (restoredEntries.isEmpty()) {
+        Q_EMIT persistentStateChanged();
+
+        return;
+    }
+
+    const auto firstRestoredRow = d->mData.size();
+
+    beginInsertRows(QModelIndex(), firstRestoredRow, firstRestoredRow + restoredEntries.size() - 1);
+    for (const auto &oneEntry : restoredEntries) {
+        d->mData.push_back(oneEntry);
+        d->mTrackData.push_back({});
+        d->appendHasHeader();
+
+        if (!d->mIndexIsDirty) {
+            d->addRowToIndex(d->mData.size() - 1);
+        }
+
+        if (oneEntry.mId != 0) {
+            d->mRestoredTracksIds.insert(oneEntry.mId);
+        }
+    }
+    endInsertRows();
+
+    for (const auto &oneEntry : restoredEntries) {
+        if (oneEntry.mId == 0) {
+            Q_EMIT newTrackByNameInList(oneEntry.mTitle, oneEntry.mArtist, oneEntry.mAlbum);
+        }
+    }
 
-        enqueue({restoredTitle, restoredAlbum, restoredArtist});
+    if (!d->mRestoredTracksIds.isEmpty()) {
+        Q_EMIT restoredTracksByIdInList(d->mRestoredTracksIds.toList());
     }
 
-    emit persistentStateChanged();
+    Q_EMIT persistentStateChanged();
 }
 
 void MediaPlayList::removeSelection(QList<int> selection)
 {
-    std::sort(selection.begin(), selection.end());
-    std::reverse(selection.begin(), selection.end());
-    for (auto oneItem : selection) {
-        removeRow(oneItem);
+    std::sort(selection.begin(), selection.end(), std::greater<int>());
+    selection.erase(std::unique(selection.begin(), selection.end()), selection.end());
+
+    while (!selection.isEmpty() && selection.first() >= d->mData.size()) {
+        selection.removeFirst();
+    }
+
+    while (!selection.isEmpty() && selection.last() < 0) {
+        selection.removeLast();
+    }
+
+    if (selection.isEmpty()) {
+        return;
+    }
+
+    auto rangeIterator = selection.begin();
+
+    while (rangeIterator != selection.end()) {
+        auto rangeEnd = rangeIterator + 1;
+
+        while (rangeEnd != selection.end() && *rangeEnd == *(rangeEnd - 1) - 1) {
+            ++rangeEnd;
+        }
+
+        const auto firstRow = *(rangeEnd - 1);
+
+        internalRemoveRows(firstRow, *rangeIterator - firstRow + 1, {});
+
+        rangeIterator = rangeEnd;
     }
+
+    Q_EMIT persistentStateChanged();
 }
 
 void MediaPlayList::albumAdded(const QList<MusicAudioTrack> &tracks)
 {
-    for (int playListIndex = 0; playListIndex < d->mData.size(); ++playListIndex) {
-        auto &oneEntry = d->mData[playListIndex];
+    if (tracks.isEmpty()) {
+        return;
+    }
 
-        if (!oneEntry.mIsArtist || oneEntry.mIsValid) {
-            continue;
-        }
+    d->ensureIndex();
 
-        if (oneEntry.mArtist != tracks.first().artist()) {
-            continue;
-        }
+    const auto artistRows = d->mArtistRows.take(tracks.first().artist());
+
+    for (int artistRowIndex = artistRows.size() - 1; artistRowIndex >= 0; --artistRowIndex) {
+        const auto playListIndex = artistRows[artistRowIndex];
+        auto &oneEntry = d->mData[playListIndex];
 
         d->mTrackData[playListIndex] = tracks.first();
         oneEntry.mId = tracks.first().databaseId();
         oneEntry.mIsValid = true;
         oneEntry.mIsArtist = false;
+        d->updateHasHeader(playListIndex);
 
         Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
 
-        beginInsertRows(QModelIndex(), playListIndex + 1, playListIndex - 1 + tracks.size());
-        for (int trackIndex = 1; trackIndex < tracks.size(); ++trackIndex) {
-            d->mData.push_back(MediaPlayListEntry{tracks[trackIndex].databaseId()});
-            d->mTrackData.push_back(tracks[trackIndex]);
+        if (tracks.size() > 1) {
+            beginInsertRows(QModelIndex(), playListIndex + 1, playListIndex - 1 + tracks.size());
+            for (int trackIndex = 1; trackIndex < tracks.size(); ++trackIndex) {
+                d->mData.insert(playListIndex + trackIndex, MediaPlayListEntry{tracks[trackIndex].databaseId()});
+                d->mTrackData.insert(playListIndex + trackIndex, tracks[trackIndex]);
+                d->mHasHeader.insert(playListIndex + trackIndex, d->computeHasHeader(playListIndex + trackIndex));
+            }
+            d->mIndexIsDirty = true;
+            endInsertRows();
+        } else {
+            d->addRowToIndex(playListIndex);
+        }
+
+        const auto nextRow = playListIndex + tracks.size();
+        if (d->updateHasHeader(nextRow)) {
+            Q_EMIT dataChanged(index(nextRow, 0), index(nextRow, 0), {ColumnsRoles::HasAlbumHeader});
         }
-        endInsertRows();
 
         Q_EMIT persistentStateChanged();
     }
 }
 
+void MediaPlayList::albumTracksLoaded(qulonglong albumId, const QList<MusicAudioTrack> &tracks)
+{
+    if (!d->mPendingAlbumIds.removeOne(albumId)) {
+        return;
+    }
+
+    enqueue(tracks);
+}
+
 void MediaPlayList::trackChanged(const MusicAudioTrack &track)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
-        auto &oneEntry = d->mData[i];
+    d->ensureIndex();
 
-        if (!oneEntry.mIsArtist && oneEntry.mIsValid) {
-            if (track.databaseId() != oneEntry.mId) {
-                continue;
-            }
+    const auto trackRows = d->mTrackRows.value(track.databaseId());
 
-            if (d->mTrackData[i] != track) {
-                d->mTrackData[i] = track;
+    for (auto oneRow : trackRows) {
+        if (d->mTrackData[oneRow] != track) {
+            d->mTrackData[oneRow] = track;
+            d->updateHasHeader(oneRow);
 
-                Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-            }
-            continue;
-        } else if (!oneEntry.mIsArtist && !oneEntry.mIsValid) {
-            if (track.title() != oneEntry.mTitle) {
-                continue;
-            }
+            Q_EMIT dataChanged(index(oneRow, 0), index(oneRow, 0), {});
 
-            if (track.albumName() != oneEntry.mAlbum) {
-                continue;
+            if (d->updateHasHeader(oneRow + 1)) {
+                Q_EMIT dataChanged(index(oneRow + 1, 0), index(oneRow + 1, 0), {ColumnsRoles::HasAlbumHeader});
             }
+        }
+    }
 
-            if (track.artist() != oneEntry.mArtist) {
-                continue;
-            }
+    auto unresolvedIterator = d->mUnresolvedRows.find(MediaPlayListPrivate::trackKey(track.title(), track.albumName(), track.artist()));
 
-            d->mTrackData[i] = track;
-            oneEntry.mId = track.databaseId();
-            oneEntry.mIsValid = true;
+    if (unresolvedIterator == d->mUnresolvedRows.end()) {
+        return;
+    }
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-            break;
-        }
+    const auto resolvedRow = *std::min_element(unresolvedIterator->begin(), unresolvedIterator->end());
+
+    d->removeRowFromIndex(resolvedRow);
+
+    auto &oneEntry = d->mData[resolvedRow];
+
+    d->mTrackData[resolvedRow] = track;
+    oneEntry.mId = track.databaseId();
+    oneEntry.mIsValid = true;
+
+    d->addRowToIndex(resolvedRow);
+    d->updateHasHeader(resolvedRow);
+
+    Q_EMIT dataChanged(index(resolvedRow, 0), index(resolvedRow, 0), {});
+
+    if (d->updateHasHeader(resolvedRow + 1)) {
+        Q_EMIT dataChanged(index(resolvedRow + 1, 0), index(resolvedRow + 1, 0), {ColumnsRoles::HasAlbumHeader});
     }
 }
 
 void MediaPlayList::trackRemoved(const MusicAudioTrack &track)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
-        auto &oneEntry = d->mData[i];
+    d->ensureIndex();
 
-        if (oneEntry.mIsValid) {
-            if (oneEntry.mId == track.databaseId()) {
-                oneEntry.mTitle = track.title();
-                oneEntry.mArtist = track.artist();
-                oneEntry.mAlbum = track.albumName();
+    const auto trackRows = d->mTrackRows.take(track.databaseId());
 
-                oneEntry.mIsValid = false;
+    for (auto oneRow : trackRows) {
+        auto &oneEntry = d->mData[oneRow];
 
-                Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
+        oneEntry.mTitle = track.title();
+        oneEntry.mArtist = track.artist();
+        oneEntry.mAlbum = track.albumName();
+
+        oneEntry.mIsValid = false;
+
+        d->addRowToIndex(oneRow);
+        d->updateHasHeader(oneRow);
+
+        Q_EMIT dataChanged(index(oneRow, 0), index(oneRow, 0), {});
+
+        if (d->updateHasHeader(oneRow + 1)) {
+            Q_EMIT dataChanged(index(oneRow + 1, 0), index(oneRow + 1, 0), {ColumnsRoles::HasAlbumHeader});
+        }
+    }
+}
+
+void MediaPlayList::tracksRestored(const QList<MusicAudioTrack> &tracks)
+{
+    auto restoredTracks = QHash<qulonglong, MusicAudioTrack>();
+    restoredTracks.reserve(tracks.size());
+
+    for (const auto &oneTrack : tracks) {
+        restoredTracks[oneTrack.databaseId()] = oneTrack;
+    }
+
+    auto firstChangedRow = -1;
+    auto lastChangedRow = -1;
+
+    for (int row = 0; row < d->mData.size(); ++row) {
+        auto &oneEntry = d->mData[row];
+
+        if (oneEntry.mIsValid || oneEntry.mIsArtist || !d->mRestoredTracksIds.contains(oneEntry.mId)) {
+            continue;
+        }
+
+        const auto itTrack = restoredTracks.constFind(oneEntry.mId);
+
+        if (itTrack != restoredTracks.constEnd() && itTrack->title() == oneEntry.mTitle &&
+                itTrack->albumName() == oneEntry.mAlbum && itTrack->artist() == oneEntry.mArtist) {
+            d->mTrackData[row] = *itTrack;
+            oneEntry.mIsValid = true;
+
+            if (firstChangedRow == -1) {
+                firstChangedRow = row;
             }
+            lastChangedRow = row;
+        } else {
+            oneEntry.mId = 0;
+
+            Q_EMIT newTrackByNameInList(oneEntry.mTitle, oneEntry.mArtist, oneEntry.mAlbum);
         }
     }
+
+    d->mRestoredTracksIds.clear();
+    d->mIndexIsDirty = true;
+
+    if (firstChangedRow != -1) {
+        Q_EMIT dataChanged(index(firstChangedRow, 0), index(lastChangedRow, 0), {});
+    }
 }
 
 void MediaPlayList::setMusicListenersManager(MusicListenersManager *musicListenersManager)
@@ -579,6 +941,10 @@ void MediaPlayList::setMusicListenersManager(MusicListenersManager *musicListene
 
     if (d->mMusicListenersManager) {
         d->mMusicListenersManager->subscribeForTracks(this);
+
+        if (!d->mRestoredTracksIds.isEmpty()) {
+            Q_EMIT restoredTracksByIdInList(d->mRestoredTracksIds.toList());
+        }
     }
 
     Q_EMIT musicListenersManagerChanged();
@@ -586,39 +952,16 @@ void MediaPlayList::setMusicListenersManager(MusicListenersManager *musicListene
 
 bool MediaPlayList::rowHasHeader(int row) const
 {
-    if (row >= rowCount()) {
-        return false;
-    }
-
-    if (row < 0) {
+    if (row < 0 || row >= d->mHasHeader.size()) {
         return false;
     }
 
-    if (row - 1 < 0) {
-        return true;
-    }
-
-    auto currentAlbum = QString();
-    if (d->mData[row].mIsValid) {
-        qDebug() << d->mData[row].mId;
-        qDebug() << d->mTrackData[row].albumName();
-        currentAlbum = d->mTrackData[row].albumName();
-    } else {
-        currentAlbum = d->mData[row].mAlbum;
-    }
-
-    auto previousAlbum = QString();
-    if (d->mData[row - 1].mIsValid) {
-        previousAlbum = d->mTrackData[row - 1].albumName();
-    } else {
-        previousAlbum = d->mData[row - 1].mAlbum;
-    }
-
-    if (currentAlbum == previousAlbum) {
-        return false;
-    }
+    return d->mHasHeader[row];
+}
 
-    return true;
+void MediaPlayList::invalidatePersistentState()
+{
+    d->mPersistentStateIsDirty = true;
 }
 
 
@@ -97,6 +97,8 @@ public:
 
     Q_INVOKABLE void enqueue(const MusicAlbum &album);
 
+    Q_INVOKABLE void enqueue(const QList<MusicAudioTrack> &newTracks);
+
     Q_INVOKABLE void enqueue(const QString &artistName);
 
     Q_INVOKABLE void clearAndEnqueue(qulonglong newTrackId);
@@ -105,6 +107,8 @@ public:
 
     Q_INVOKABLE void clearAndEnqueue(const MusicAlbum &album);
 
+    Q_INVOKABLE void clearAndEnqueue(const QList<MusicAudioTrack> &newTracks);
+
     Q_INVOKABLE void clearAndEnqueue(const QString &artistName);
 
     Q_INVOKABLE bool moveRows(const QModelIndex &sourceParent, int sourceRow, int count, const QModelIndex &destinationParent, int destinationChild) override;
@@ -123,8 +127,14 @@ Q_SIGNALS:
 
     void newTrackByIdInList(qulonglong newTrackId);
 
+    void newTracksByIdInList(const QList<qulonglong> &newTracksIds);
+
+    void restoredTracksByIdInList(const QList<qulonglong> &tracksIds);
+
     void newArtistInList(const QString &artist);
 
+    void newAlbumInList(qulonglong albumId);
+
     void trackHasBeenAdded(const QString &title, const QUrl &image);
 
     void persistentStateChanged();
@@ -139,18 +149,26 @@ public Q_SLOTS:
 
     void albumAdded(const QList<MusicAudioTrack> &tracks);
 
+    void albumTracksLoaded(qulonglong albumId, const QList<MusicAudioTrack> &tracks);
+
     void trackChanged(const MusicAudioTrack &track);
 
     void trackRemoved(const MusicAudioTrack &track);
 
+    void tracksRestored(const QList<MusicAudioTrack> &tracks);
+
     void setMusicListenersManager(MusicListenersManager* musicListenersManager);
 
 private Q_SLOTS:
 
     bool rowHasHeader(int row) const;
 
+    void invalidatePersistentState();
+
 private:
 
+    void internalRemoveRows(int row, int count, const QModelIndex &parent);
+
     MediaPlayListPrivate *d;
 
 };
@@ -182,6 +182,10 @@ QVariantMap MediaPlayer2Player::Metadata() const
 
 qlonglong MediaPlayer2Player::Position() const
 {
+    if (m_manageAudioPlayer) {
+        return qlonglong(m_manageAudioPlayer->playerPosition()) * 1000;
+    }
+
     return m_position;
 }
 
@@ -233,8 +237,12 @@ bool MediaPlayer2Player::CanControl() const
 void MediaPlayer2Player::Seek(qlonglong Offset) const
 {
     if (mediaPlayerPresent()) {
-        int offset = (m_position + Offset) / 1000;
-        m_manageAudioPlayer->playerSeek(offset);
+        auto newPosition = qMax(qlonglong(0), qlonglong(m_manageAudioPlayer->playerPosition()) * 1000 + Offset);
+        m_manageAudioPlayer->playerSeek(newPosition / 1000);
+
+        if (!m_manageAudioPlayer->positionUpdatesEnabled()) {
+            Q_EMIT Seeked(newPosition);
+        }
     }
 }
 
@@ -247,6 +255,10 @@ void MediaPlayer2Player::SetPosition(const QDBusObjectPath &trackId, qlonglong p
 {
     if (trackId.path() == m_currentTrackId) {
         m_manageAudioPlayer->playerSeek(pos / 1000);
+
+        if (!m_manageAudioPlayer->positionUpdatesEnabled()) {
+            Q_EMIT Seeked(pos);
+        }
     }
 }
 
@@ -25,10 +25,11 @@
 #include <QString>
 #include <QUrl>
 #include <QMap>
+#include <QSharedData>
 
 #include <QDebug>
 
-class MusicAlbumPrivate
+class MusicAlbumPrivate : public QSharedData
 {
 public:
 
@@ -48,33 +49,40 @@ public:
 
     QList<MusicAudioTrack> mTracks;
 
+    QStringList mAllArtists;
+
+    QString mAllArtistsText;
+
+    QStringList mAllTracksTitle;
+
     int mTracksCount = 0;
 
+    int mHighestTrackRating = 0;
+
     bool mIsValid = false;
 
     bool mIsSingleDiscAlbum = true;
 
+    bool mIsTracksLoaded = true;
+
 };
 
 MusicAlbum::MusicAlbum() : d(new MusicAlbumPrivate)
 {
 }
 
-MusicAlbum::MusicAlbum(MusicAlbum &&other) : d(other.d)
+MusicAlbum::MusicAlbum(MusicAlbum &&other) : d(std::move(other.d))
 {
-    other.d = nullptr;
 }
 
-MusicAlbum::MusicAlbum(const MusicAlbum &other) : d(new MusicAlbumPrivate(*other.d))
+MusicAlbum::MusicAlbum(const MusicAlbum &other) : d(other.d)
 {
 }
 
 MusicAlbum& MusicAlbum::operator=(MusicAlbum &&other)
 {
     if (&other != this) {
-        delete d;
-        d = other.d;
-        other.d = nullptr;
+        d = std::move(other.d);
     }
 
     return *this;
@@ -83,7 +91,7 @@ MusicAlbum& MusicAlbum::operator=(MusicAlbum &&other)
 MusicAlbum& MusicAlbum::operator=(const MusicAlbum &other)
 {
     if (&other != this) {
-        (*d) = (*other.d);
+        d = other.d;
     }
 
     return *this;
@@ -91,7 +99,6 @@ MusicAlbum& MusicAlbum::operator=(const MusicAlbum &other)
 
 MusicAlbum::~MusicAlbum()
 {
-    delete d;
 }
 
 void MusicAlbum::setValid(bool value)
@@ -141,6 +148,10 @@ void MusicAlbum::setTracksCount(int count)
 
 int MusicAlbum::tracksCount() const
 {
+    if (!d->mIsTracksLoaded) {
+        return d->mTracksCount;
+    }
+
     return d->mTracks.size();
 }
 
@@ -197,6 +208,25 @@ bool MusicAlbum::isSingleDiscAlbum() const
 void MusicAlbum::setTracks(const QList<MusicAudioTrack> &allTracks)
 {
     d->mTracks = allTracks;
+    d->mTracksCount = allTracks.size();
+    d->mIsTracksLoaded = true;
+
+    updateTracksSummary();
+}
+
+void MusicAlbum::setIsTracksLoaded(bool value)
+{
+    d->mIsTracksLoaded = value;
+}
+
+bool MusicAlbum::isTracksLoaded() const
+{
+    return d->mIsTracksLoaded;
+}
+
+const QList<MusicAudioTrack> &MusicAlbum::allTracks() const
+{
+    return d->mTracks;
 }
 
 MusicAudioTrack MusicAlbum::trackFromIndex(int index) const
@@ -213,8 +243,9 @@ int MusicAlbum::trackIndexFromId(qulonglong id) const
 {
     int result = -1;
 
-    for (result = 0; result < d->mTracks.size(); ++result) {
-        if (d->mTracks[result].databaseId() == id) {
+    const auto &currentTracks = d->mTracks;
+    for (result = 0; result < currentTracks.size(); ++result) {
+        if (currentTracks[result].databaseId() == id) {
             return result;
         }
     }
@@ -224,64 +255,89 @@ int MusicAlbum::trackIndexFromId(qulonglong id) const
     return result;
 }
 
-QStringList MusicAlbum::allArtists() const
+void MusicAlbum::setAllArtists(const QStringList &value)
 {
-    auto result = QList<QString>();
-
-    result.reserve(d->mTracks.size());
-
-    const auto &allTracks = d->mTracks;
-    for (const auto &oneTrack : allTracks) {
-        result.push_back(oneTrack.artist());
-    }
-
-    std::sort(result.begin(), result.end());
-    result.erase(std::unique(result.begin(), result.end()), result.end());
-
-    return result;
+    d->mAllArtists = value;
+    d->mAllArtistsText = value.join(QStringLiteral(", "));
 }
 
-QStringList MusicAlbum::allTracksTitle() const
+const QStringList &MusicAlbum::allArtists() const
 {
-    auto result = QList<QString>();
-
-    result.reserve(d->mTracks.size());
+    return d->mAllArtists;
+}
 
-    const auto &allTracks = d->mTracks;
-    for (const auto &oneTrack : allTracks) {
-        result.push_back(oneTrack.title());
-    }
+const QString &MusicAlbum::allArtistsText() const
+{
+    return d->mAllArtistsText;
+}
 
-    std::sort(result.begin(), result.end());
-    result.erase(std::unique(result.begin(), result.end()), result.end());
+void MusicAlbum::setAllTracksTitle(const QStringList &value)
+{
+    d->mAllTracksTitle = value;
+}
 
-    return result;
+const QStringList &MusicAlbum::allTracksTitle() const
+{
+    return d->mAllTracksTitle;
 }
 
 bool MusicAlbum::isEmpty() const
 {
-    return d->mTracks.isEmpty();
+    return tracksCount() == 0;
 }
 
 void MusicAlbum::removeTrackFromIndex(int index)
 {
-    if (index < 0 || index >= tracksCount()) {
+    if (index < 0 || index >= d->mTracks.size()) {
         return;
     }
 
     --d->mTracksCount;
     d->mTracks.removeAt(index);
+
+    updateTracksSummary();
 }
 
 void MusicAlbum::insertTrack(const MusicAudioTrack &newTrack, int index)
 {
     d->mTracks.insert(index, newTrack);
     ++d->mTracksCount;
+
+    updateTracksSummary();
 }
 
 void MusicAlbum::updateTrack(const MusicAudioTrack &modifiedTrack, int index)
 {
     d->mTracks[index] = modifiedTrack;
+
+    updateTracksSummary();
+}
+
+void MusicAlbum::updateTracksSummary()
+{
+    auto newAllArtists = QStringList();
+    auto newAllTracksTitle = QStringList();
+    auto newHighestTrackRating = 0;
+
+    const auto &currentTracks = d->mTracks;
+    newAllArtists.reserve(currentTracks.size());
+    newAllTracksTitle.reserve(currentTracks.size());
+
+    for (const auto &oneTrack : currentTracks) {
+        newAllArtists.push_back(oneTrack.artist());
+        newAllTracksTitle.push_back(oneTrack.title());
+        newHighestTrackRating = std::max(newHighestTrackRating, oneTrack.rating());
+    }
+
+    std::sort(newAllArtists.begin(), newAllArtists.end());
+    newAllArtists.erase(std::unique(newAllArtists.begin(), newAllArtists.end()), newAllArtists.end());
+
+    std::sort(newAllTracksTitle.begin(), newAllTracksTitle.end());
+    newAllTracksTitle.erase(std::unique(newAllTracksTitle.begin(), newAllTracksTitle.end()), newAllTracksTitle.end());
+
+    setAllArtists(newAllArtists);
+    d->mAllTracksTitle = newAllTracksTitle;
+    d->mHighestTrackRating = newHighestTrackRating;
 }
 
 QDebug& operator<<(QDebug &stream, const MusicAlbum &data)
@@ -296,14 +352,12 @@ bool operator==(const MusicAlbum &album1, const MusicAlbum &album2)
     return album1.artist() == album2.artist() && album1.title() == album2.title();
 }
 
-int MusicAlbum::highestTrackRating() const
+void MusicAlbum::setHighestTrackRating(int value)
 {
-    int result = 0;
-
-    const auto &allTracks = d->mTracks;
-    for (const auto &oneTrack : allTracks) {
-        result = std::max(result, oneTrack.rating());
-    }
+    d->mHighestTrackRating = value;
+}
 
-    return result;
+int MusicAlbum::highestTrackRating() const
+{
+    return d->mHighestTrackRating;
 }
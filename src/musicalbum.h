@@ -27,6 +27,7 @@
 #include <QMap>
 #include <QStringList>
 #include <QMetaType>
+#include <QSharedDataPointer>
 
 class MusicAlbumPrivate;
 class QDebug;
@@ -90,15 +91,27 @@ public:
 
     void setTracks(const QList<MusicAudioTrack> &allTracks);
 
+    void setIsTracksLoaded(bool value);
+
+    bool isTracksLoaded() const;
+
+    const QList<MusicAudioTrack>& allTracks() const;
+
     MusicAudioTrack trackFromIndex(int index) const;
 
     qulonglong trackIdFromIndex(int index) const;
 
     int trackIndexFromId(qulonglong id) const;
 
-    QStringList allArtists() const;
+    void setAllArtists(const QStringList &value);
+
+    const QStringList& allArtists() const;
 
-    QStringList allTracksTitle() const;
+    const QString& allArtistsText() const;
+
+    void setAllTracksTitle(const QStringList &value);
+
+    const QStringList& allTracksTitle() const;
 
     bool isEmpty() const;
 
@@ -108,11 +121,15 @@ public:
 
     void updateTrack(const MusicAudioTrack &modifiedTrack, int index);
 
+    void setHighestTrackRating(int value);
+
     int highestTrackRating() const;
 
 private:
 
-    MusicAlbumPrivate *d;
+    void updateTracksSummary();
+
+    QSharedDataPointer<MusicAlbumPrivate> d;
 
 };
 
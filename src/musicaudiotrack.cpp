@@ -19,9 +19,90 @@
 
 #include "musicaudiotrack.h"
 
+#include <QSharedData>
+#include <QHash>
+#include <QSet>
+#include <QThreadStorage>
+
 #include <QDebug>
 
-class MusicAudioTrackPrivate
+class MusicAudioTrackValuesPool
+{
+public:
+
+    static MusicAudioTrackValuesPool& instance()
+    {
+        static QThreadStorage<MusicAudioTrackValuesPool*> threadPools;
+
+        if (!threadPools.hasLocalData()) {
+            threadPools.setLocalData(new MusicAudioTrackValuesPool);
+        }
+
+        return *threadPools.localData();
+    }
+
+    QString intern(const QString &value)
+    {
+        return internValue(mStrings, mStringsPruneSize, value);
+    }
+
+    QUrl intern(const QUrl &value)
+    {
+        return internValue(mUrls, mUrlsPruneSize, value);
+    }
+
+private:
+
+    template <typename T>
+    static T internValue(QSet<T> &values, int &pruneSize, const T &value)
+    {
+        if (value.isEmpty()) {
+            return {};
+        }
+
+        auto itValue = values.constFind(value);
+        if (itValue != values.constEnd()) {
+            return *itValue;
+        }
+
+        if (values.size() >= pruneSize) {
+            pruneValues(values);
+
+            pruneSize = 2 * values.size();
+            if (pruneSize < mMinimumPruneSize) {
+                pruneSize = mMinimumPruneSize;
+            }
+        }
+
+        return *values.insert(value);
+    }
+
+    template <typename T>
+    static void pruneValues(QSet<T> &values)
+    {
+        auto itValue = values.begin();
+        while (itValue != values.end()) {
+            if (itValue->isDetached()) {
+                itValue = values.erase(itValue);
+            } else {
+                ++itValue;
+            }
+        }
+    }
+
+    static const int mMinimumPruneSize = 1024;
+
+    QSet<QString> mStrings;
+
+    int mStringsPruneSize = mMinimumPruneSize;
+
+    QSet<QUrl> mUrls;
+
+    int mUrlsPruneSize = mMinimumPruneSize;
+
+};
+
+class MusicAudioTrackPrivate : public QSharedData
 {
 public:
 
@@ -33,9 +114,9 @@ public:
                            const QString &aTitle, const QString &aArtist, const QString &aAlbumName,
                            const QString &aAlbumArtist, int aTrackNumber, QTime aDuration,
                            const QUrl &aResourceURI, const QUrl &aAlbumCover, int rating)
-        : mId(aId), mParentId(aParentId), mTitle(aTitle), mArtist(aArtist),
-          mAlbumName(aAlbumName), mAlbumArtist(aAlbumArtist), mTrackNumber(aTrackNumber),
-          mDuration(aDuration), mResourceURI(aResourceURI), mAlbumCover(aAlbumCover),
+        : mId(aId), mParentId(internValue(aParentId)), mTitle(aTitle), mArtist(internValue(aArtist)),
+          mAlbumName(internValue(aAlbumName)), mAlbumArtist(internValue(aAlbumArtist)), mTrackNumber(aTrackNumber),
+          mDuration(aDuration), mResourceURI(aResourceURI), mAlbumCover(internValue(aAlbumCover)),
           mRating(rating), mIsValid(aValid)
     {
     }
@@ -44,13 +125,19 @@ public:
                            const QString &aTitle, const QString &aArtist, const QString &aAlbumName, const QString &aAlbumArtist,
                            int aTrackNumber, int aDiscNumber, QTime aDuration, const QUrl &aResourceURI,
                            const QUrl &aAlbumCover, int rating)
-        : mId(aId), mParentId(aParentId), mTitle(aTitle), mArtist(aArtist),
-          mAlbumName(aAlbumName), mAlbumArtist(aAlbumArtist), mTrackNumber(aTrackNumber),
+        : mId(aId), mParentId(internValue(aParentId)), mTitle(aTitle), mArtist(internValue(aArtist)),
+          mAlbumName(internValue(aAlbumName)), mAlbumArtist(internValue(aAlbumArtist)), mTrackNumber(aTrackNumber),
           mDiscNumber(aDiscNumber), mDuration(aDuration), mResourceURI(aResourceURI),
-          mAlbumCover(aAlbumCover), mRating(rating), mIsValid(aValid)
+          mAlbumCover(internValue(aAlbumCover)), mRating(rating), mIsValid(aValid)
     {
     }
 
+    template <typename T>
+    static T internValue(const T &value)
+    {
+        return MusicAudioTrackValuesPool::instance().intern(value);
+    }
+
     qulonglong mDatabaseId = 0;
 
     QString mId;
@@ -77,6 +164,10 @@ public:
 
     int mRating = -1;
 
+    qint64 mFileSize = -1;
+
+    QDateTime mFileModifiedTime;
+
     bool mIsValid = false;
 
 };
@@ -100,26 +191,22 @@ MusicAudioTrack::MusicAudioTrack(bool aValid, const QString &aId, const QString
 {
 }
 
-MusicAudioTrack::MusicAudioTrack(MusicAudioTrack &&other) : d(other.d)
+MusicAudioTrack::MusicAudioTrack(MusicAudioTrack &&other) : d(std::move(other.d))
 {
-    other.d = nullptr;
 }
 
-MusicAudioTrack::MusicAudioTrack(const MusicAudioTrack &other) : d(new MusicAudioTrackPrivate(*other.d))
+MusicAudioTrack::MusicAudioTrack(const MusicAudioTrack &other) : d(other.d)
 {
 }
 
 MusicAudioTrack::~MusicAudioTrack()
 {
-    delete d;
 }
 
 MusicAudioTrack& MusicAudioTrack::operator=(MusicAudioTrack &&other)
 {
     if (this != &other) {
-        delete d;
-        d = other.d;
-        other.d = nullptr;
+        d = std::move(other.d);
     }
 
     return *this;
@@ -128,7 +215,7 @@ MusicAudioTrack& MusicAudioTrack::operator=(MusicAudioTrack &&other)
 MusicAudioTrack& MusicAudioTrack::operator=(const MusicAudioTrack &other)
 {
     if (this != &other) {
-        (*d) = (*other.d);
+        d = other.d;
     }
 
     return *this;
@@ -177,7 +264,7 @@ qulonglong MusicAudioTrack::databaseId() const
     return d->mDatabaseId;
 }
 
-void MusicAudioTrack::setId(const QString &value) const
+void MusicAudioTrack::setId(const QString &value)
 {
     d->mId = value;
 }
@@ -187,9 +274,9 @@ QString MusicAudioTrack::id() const
     return d->mId;
 }
 
-void MusicAudioTrack::setParentId(const QString &value) const
+void MusicAudioTrack::setParentId(const QString &value)
 {
-    d->mParentId = value;
+    d->mParentId = MusicAudioTrackPrivate::internValue(value);
 }
 
 QString MusicAudioTrack::parentId() const
@@ -197,7 +284,7 @@ QString MusicAudioTrack::parentId() const
     return d->mParentId;
 }
 
-void MusicAudioTrack::setTitle(const QString &value) const
+void MusicAudioTrack::setTitle(const QString &value)
 {
     d->mTitle = value;
 }
@@ -207,9 +294,9 @@ QString MusicAudioTrack::title() const
     return d->mTitle;
 }
 
-void MusicAudioTrack::setArtist(const QString &value) const
+void MusicAudioTrack::setArtist(const QString &value)
 {
-    d->mArtist = value;
+    d->mArtist = MusicAudioTrackPrivate::internValue(value);
 }
 
 QString MusicAudioTrack::artist() const
@@ -217,9 +304,9 @@ QString MusicAudioTrack::artist() const
     return d->mArtist;
 }
 
-void MusicAudioTrack::setAlbumName(const QString &value) const
+void MusicAudioTrack::setAlbumName(const QString &value)
 {
-    d->mAlbumName = value;
+    d->mAlbumName = MusicAudioTrackPrivate::internValue(value);
 }
 
 QString MusicAudioTrack::albumName() const
@@ -227,9 +314,9 @@ QString MusicAudioTrack::albumName() const
     return d->mAlbumName;
 }
 
-void MusicAudioTrack::setAlbumArtist(const QString &value) const
+void MusicAudioTrack::setAlbumArtist(const QString &value)
 {
-    d->mAlbumArtist = value;
+    d->mAlbumArtist = MusicAudioTrackPrivate::internValue(value);
 }
 
 QString MusicAudioTrack::albumArtist() const
@@ -237,9 +324,9 @@ QString MusicAudioTrack::albumArtist() const
     return d->mAlbumArtist;
 }
 
-void MusicAudioTrack::setAlbumCover(const QUrl &value) const
+void MusicAudioTrack::setAlbumCover(const QUrl &value)
 {
-    d->mAlbumCover = value;
+    d->mAlbumCover = MusicAudioTrackPrivate::internValue(value);
 }
 
 QUrl MusicAudioTrack::albumCover() const
@@ -287,7 +374,7 @@ const QUrl &MusicAudioTrack::resourceURI() const
     return d->mResourceURI;
 }
 
-void MusicAudioTrack::setRating(int value) const
+void MusicAudioTrack::setRating(int value)
 {
     d->mRating = value;
 }
@@ -297,6 +384,26 @@ int MusicAudioTrack::rating() const
     return d->mRating;
 }
 
+void MusicAudioTrack::setFileSize(qint64 value)
+{
+    d->mFileSize = value;
+}
+
+qint64 MusicAudioTrack::fileSize() const
+{
+    return d->mFileSize;
+}
+
+void MusicAudioTrack::setFileModifiedTime(const QDateTime &value)
+{
+    d->mFileModifiedTime = value;
+}
+
+const QDateTime &MusicAudioTrack::fileModifiedTime() const
+{
+    return d->mFileModifiedTime;
+}
+
 QDebug& operator<<(QDebug &stream, const MusicAudioTrack &data)
 {
     stream << data.title() << data.artist() << data.albumName() << data.albumArtist() << data.duration();
@@ -23,7 +23,9 @@
 #include <QString>
 #include <QTime>
 #include <QUrl>
+#include <QDateTime>
 #include <QMetaType>
+#include <QSharedDataPointer>
 
 class MusicAudioTrackPrivate;
 class QDebug;
@@ -66,31 +68,31 @@ public:
 
     qulonglong databaseId() const;
 
-    void setId(const QString &value) const;
+    void setId(const QString &value);
 
     QString id() const;
 
-    void setParentId(const QString &value) const;
+    void setParentId(const QString &value);
 
     QString parentId() const;
 
-    void setTitle(const QString &value) const;
+    void setTitle(const QString &value);
 
     QString title() const;
 
-    void setArtist(const QString &value) const;
+    void setArtist(const QString &value);
 
     QString artist() const;
 
-    void setAlbumName(const QString &value) const;
+    void setAlbumName(const QString &value);
 
     QString albumName() const;
 
-    void setAlbumArtist(const QString &value) const;
+    void setAlbumArtist(const QString &value);
 
     QString albumArtist() const;
 
-    void setAlbumCover(const QUrl &value) const;
+    void setAlbumCover(const QUrl &value);
 
     QUrl albumCover() const;
 
@@ -110,13 +112,21 @@ public:
 
     const QUrl& resourceURI() const;
 
-    void setRating(int value) const;
+    void setRating(int value);
 
     int rating() const;
 
+    void setFileSize(qint64 value);
+
+    qint64 fileSize() const;
+
+    void setFileModifiedTime(const QDateTime &value);
+
+    const QDateTime& fileModifiedTime() const;
+
 private:
 
-    MusicAudioTrackPrivate *d = nullptr;
+    QSharedDataPointer<MusicAudioTrackPrivate> d;
 
 };
 
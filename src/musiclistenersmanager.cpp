@@ -83,24 +83,22 @@ MusicListenersManager::MusicListenersManager(QObject *parent)
     QMetaObject::invokeMethod(&d->mDatabaseInterface, "init", Qt::QueuedConnection,
                               Q_ARG(QString, QStringLiteral("listeners")), Q_ARG(QString, databaseFileName));
 
-    connect(&d->mDatabaseInterface, &DatabaseInterface::artistAdded,
-               this, &MusicListenersManager::artistAdded);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumAdded,
-               this, &MusicListenersManager::albumAdded);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::trackAdded,
-               this, &MusicListenersManager::trackAdded);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::artistRemoved,
-               this, &MusicListenersManager::artistRemoved);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumRemoved,
-               this, &MusicListenersManager::albumRemoved);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::trackRemoved,
-               this, &MusicListenersManager::trackRemoved);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::artistModified,
-               this, &MusicListenersManager::artistModified);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumModified,
-               this, &MusicListenersManager::albumModified);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::trackModified,
-               this, &MusicListenersManager::trackModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::artistsAdded,
+               this, &MusicListenersManager::artistsAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsAdded,
+               this, &MusicListenersManager::albumsAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksAdded,
+               this, &MusicListenersManager::tracksAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksModified,
+               this, &MusicListenersManager::tracksModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsModified,
+               this, &MusicListenersManager::albumsModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksRemoved,
+               this, &MusicListenersManager::tracksRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsRemoved,
+               this, &MusicListenersManager::albumsRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::artistsRemoved,
+               this, &MusicListenersManager::artistsRemoved);
 
     connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
             this, &MusicListenersManager::applicationAboutToQuit);
@@ -122,15 +120,20 @@ void MusicListenersManager::subscribeForTracks(MediaPlayList *client)
 
     helper->moveToThread(&d->mDatabaseThread);
 
-    connect(this, &MusicListenersManager::trackRemoved, helper, &TracksListener::trackRemoved);
-    connect(this, &MusicListenersManager::trackAdded, helper, &TracksListener::trackAdded);
-    connect(this, &MusicListenersManager::trackModified, helper, &TracksListener::trackModified);
+    connect(this, &MusicListenersManager::tracksRemoved, helper, &TracksListener::tracksRemoved);
+    connect(this, &MusicListenersManager::tracksAdded, helper, &TracksListener::tracksAdded);
+    connect(this, &MusicListenersManager::tracksModified, helper, &TracksListener::tracksModified);
     connect(helper, &TracksListener::trackHasChanged, client, &MediaPlayList::trackChanged);
     connect(helper, &TracksListener::trackHasBeenRemoved, client, &MediaPlayList::trackRemoved);
     connect(helper, &TracksListener::albumAdded, client, &MediaPlayList::albumAdded);
+    connect(helper, &TracksListener::tracksHaveBeenRestored, client, &MediaPlayList::tracksRestored);
+    connect(helper, &TracksListener::albumTracksHaveBeenLoaded, client, &MediaPlayList::albumTracksLoaded);
     connect(client, &MediaPlayList::newTrackByIdInList, helper, &TracksListener::trackByIdInList);
+    connect(client, &MediaPlayList::newTracksByIdInList, helper, &TracksListener::newTracksByIdInList);
     connect(client, &MediaPlayList::newTrackByNameInList, helper, &TracksListener::trackByNameInList);
+    connect(client, &MediaPlayList::restoredTracksByIdInList, helper, &TracksListener::tracksByIdInList);
     connect(client, &MediaPlayList::newArtistInList, helper, &TracksListener::newArtistInList);
+    connect(client, &MediaPlayList::newAlbumInList, helper, &TracksListener::newAlbumInList);
 }
 
 void MusicListenersManager::databaseReady()
@@ -53,23 +53,21 @@ Q_SIGNALS:
 
     void viewDatabaseChanged();
 
-    void artistAdded(const MusicArtist &newArtist);
+    void artistsAdded(const QList<MusicArtist> &newArtists);
 
-    void albumAdded(const MusicAlbum &newAlbum);
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
 
-    void trackAdded(qulonglong id);
+    void tracksAdded(const QList<qulonglong> &newTracks);
 
-    void artistRemoved(const MusicArtist &removedArtist);
+    void tracksModified(const QList<qulonglong> &modifiedTracks);
 
-    void albumRemoved(const MusicAlbum &removedAlbum);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
-    void trackRemoved(qulonglong id);
+    void tracksRemoved(const QList<MusicAudioTrack> &removedTracks);
 
-    void artistModified(const MusicArtist &modifiedArtist);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
-    void albumModified(const MusicAlbum &modifiedAlbum);
-
-    void trackModified(qulonglong id);
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
 
     void applicationIsTerminating();
 
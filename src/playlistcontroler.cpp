@@ -23,7 +23,7 @@
 #include <QTimer>
 #include <QDebug>
 
-#include <cstdlib>
+#include <utility>
 
 PlayListControler::PlayListControler(QObject *parent)
     : QObject(parent)
@@ -35,15 +35,18 @@ void PlayListControler::setPlayListModel(QAbstractItemModel *aPlayListModel)
     if (mPlayListModel) {
         disconnect(mPlayListModel, &QAbstractItemModel::rowsInserted, this, &PlayListControler::tracksInserted);
         disconnect(mPlayListModel, &QAbstractItemModel::rowsRemoved, this, &PlayListControler::tracksRemoved);
+        disconnect(mPlayListModel, &QAbstractItemModel::rowsMoved, this, &PlayListControler::tracksMoved);
         disconnect(mPlayListModel, &QAbstractItemModel::dataChanged, this, &PlayListControler::tracksDataChanged);
         disconnect(mPlayListModel, &QAbstractItemModel::modelReset, this, &PlayListControler::playListReset);
         disconnect(mPlayListModel, &QAbstractItemModel::layoutChanged, this, &PlayListControler::playListLayoutChanged);
     }
 
     mPlayListModel = aPlayListModel;
+    clearShuffle();
 
     connect(mPlayListModel, &QAbstractItemModel::rowsInserted, this, &PlayListControler::tracksInserted);
     connect(mPlayListModel, &QAbstractItemModel::rowsRemoved, this, &PlayListControler::tracksRemoved);
+    connect(mPlayListModel, &QAbstractItemModel::rowsMoved, this, &PlayListControler::tracksMoved);
     connect(mPlayListModel, &QAbstractItemModel::dataChanged, this, &PlayListControler::tracksDataChanged);
     connect(mPlayListModel, &QAbstractItemModel::modelReset, this, &PlayListControler::playListReset);
     connect(mPlayListModel, &QAbstractItemModel::layoutChanged, this, &PlayListControler::playListLayoutChanged);
@@ -69,6 +72,7 @@ int PlayListControler::remainingTracks() const
 void PlayListControler::setRandomPlay(bool value)
 {
     mRandomPlay = value;
+    clearShuffle();
     Q_EMIT randomPlayChanged();
     setRandomPlayControl(mRandomPlay);
 }
@@ -121,6 +125,11 @@ QPersistentModelIndex PlayListControler::currentTrack() const
     return mCurrentTrack;
 }
 
+QPersistentModelIndex PlayListControler::nextTrack() const
+{
+    return mNextTrack;
+}
+
 int PlayListControler::currentTrackRow() const
 {
     return mCurrentTrack.row();
@@ -128,6 +137,8 @@ int PlayListControler::currentTrackRow() const
 
 void PlayListControler::playListReset()
 {
+    clearShuffle();
+
     if (!mCurrentTrack.isValid()) {
         resetCurrentTrack();
         return;
@@ -139,14 +150,16 @@ void PlayListControler::playListLayoutChanged(const QList<QPersistentModelIndex>
     Q_UNUSED(parents);
     Q_UNUSED(hint);
 
+    clearShuffle();
+
     qDebug() << "PlayListControler::playListLayoutChanged" << "not implemented";
 }
 
 void PlayListControler::tracksInserted(const QModelIndex &parent, int first, int last)
 {
     Q_UNUSED(parent);
-    Q_UNUSED(first);
-    Q_UNUSED(last);
+
+    insertShuffledRows(first, last);
 
     restorePlayListPosition();
     if (!mCurrentTrack.isValid()) {
@@ -171,6 +184,8 @@ void PlayListControler::tracksRemoved(const QModelIndex &parent, int first, int
         return;
     }
 
+    removeShuffledRows(first, last);
+
     if (!mCurrentTrack.isValid()) {
         if (mCurrentTrackIsValid) {
             mCurrentTrack = mPlayListModel->index(mCurrentPlayListPosition, 0);
@@ -196,6 +211,16 @@ void PlayListControler::tracksRemoved(const QModelIndex &parent, int first, int
     notifyCurrentTrackChanged();
 }
 
+void PlayListControler::tracksMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row)
+{
+    if (parent != destination) {
+        clearShuffle();
+        return;
+    }
+
+    moveShuffledRows(start, end, row);
+}
+
 void PlayListControler::skipNextTrack()
 {
     if (!mPlayListModel) {
@@ -222,9 +247,24 @@ void PlayListControler::skipNextTrack()
     }
 
     if (mRandomPlay) {
-        int randomValue = qrand();
-        randomValue = randomValue % (mPlayListModel->rowCount());
-        mCurrentTrack = mPlayListModel->index(randomValue, 0);
+        synchronizeShuffle();
+
+        auto nextRow = nextShuffledRow();
+
+        if (nextRow == -1) {
+            if (!mRepeatPlay) {
+                Q_EMIT playListFinished();
+            }
+
+            resetShuffle();
+            nextRow = nextShuffledRow();
+        }
+
+        if (nextRow == -1) {
+            return;
+        }
+
+        mCurrentTrack = mPlayListModel->index(nextRow, 0);
     } else {
         mCurrentTrack = mPlayListModel->index(mCurrentTrack.row() + 1, 0);
     }
@@ -247,9 +287,15 @@ void PlayListControler::skipPreviousTrack()
     }
 
     if (mRandomPlay) {
-        int randomValue = qrand();
-        randomValue = randomValue % (mPlayListModel->rowCount());
-        mCurrentTrack = mPlayListModel->index(randomValue, 0);
+        synchronizeShuffle();
+
+        const auto previousRow = previousShuffledRow();
+
+        if (previousRow == -1) {
+            return;
+        }
+
+        mCurrentTrack = mPlayListModel->index(previousRow, 0);
     } else {
         if (mRepeatPlay) {
             mCurrentTrack = mPlayListModel->index(mPlayListModel->rowCount() - 1, 0);
@@ -260,9 +306,35 @@ void PlayListControler::skipPreviousTrack()
     notifyCurrentTrackChanged();
 }
 
+void PlayListControler::prepareNextTrack()
+{
+    auto newNextTrack = QPersistentModelIndex();
+
+    if (mPlayListModel && mCurrentTrack.isValid()) {
+        if (mRandomPlay) {
+            synchronizeShuffle();
+
+            const auto nextRow = peekShuffledRow();
+
+            if (nextRow != -1) {
+                newNextTrack = mPlayListModel->index(nextRow, 0);
+            }
+        } else if (mCurrentTrack.row() < mPlayListModel->rowCount() - 1) {
+            newNextTrack = mPlayListModel->index(mCurrentTrack.row() + 1, 0);
+        }
+    }
+
+    if (mNextTrack == newNextTrack) {
+        return;
+    }
+
+    mNextTrack = newNextTrack;
+    Q_EMIT nextTrackChanged();
+}
+
 void PlayListControler::seedRandomGenerator(uint seed)
 {
-    qsrand(seed);
+    mRandomGenerator.seed(seed);
 }
 
 void PlayListControler::switchTo(int row)
@@ -330,6 +402,11 @@ void PlayListControler::notifyCurrentTrackChanged()
     if (mCurrentTrackIsValid) {
         mCurrentPlayListPosition = mCurrentTrack.row();
     }
+
+    if (mNextTrack.isValid()) {
+        mNextTrack = QPersistentModelIndex();
+        Q_EMIT nextTrackChanged();
+    }
 }
 
 void PlayListControler::setPersistentState(const QVariantMap &persistentStateValue)
@@ -381,6 +458,221 @@ void PlayListControler::resetCurrentTrack()
         }
     }
 }
+int PlayListControler::randomPosition(int first, int last)
+{
+    const auto range = static_cast<quint32>(last - first + 1);
+    const auto threshold = static_cast<quint32>(-range) % range;
+
+    auto randomValue = static_cast<quint32>(mRandomGenerator());
+    while (randomValue < threshold) {
+        randomValue = static_cast<quint32>(mRandomGenerator());
+    }
+
+    return first + static_cast<int>(randomValue % range);
+}
+
+/*
+ * mShuffleOrder is a permutation of the play list rows built lazily with Fisher-Yates:
+ * positions before mShuffleFrontier have already been drawn and are the play history of the
+ * current cycle, mShuffleCursor is the position of the current track in it and positions from
+ * mShuffleFrontier onwards are the tracks not yet played in this cycle.
+ * mShufflePositions is the inverse permutation.
+ */
+void PlayListControler::clearShuffle()
+{
+    mShuffleOrder.clear();
+    mShufflePositions.clear();
+    mShuffleCursor = -1;
+    mShuffleFrontier = 0;
+}
+
+void PlayListControler::resetShuffle()
+{
+    const auto rowCount = mPlayListModel->rowCount();
+
+    mShuffleOrder.resize(rowCount);
+    for (int row = 0; row < rowCount; ++row) {
+        mShuffleOrder[row] = row;
+    }
+    mShufflePositions = mShuffleOrder;
+
+    mShuffleCursor = -1;
+    mShuffleFrontier = 0;
+
+    if (mCurrentTrack.isValid() && mCurrentTrack.row() < rowCount) {
+        mShuffleCursor = drawShufflePosition(mCurrentTrack.row());
+    }
+}
+
+void PlayListControler::updateShufflePositions()
+{
+    mShufflePositions.resize(mShuffleOrder.size());
+    for (int position = 0; position < mShuffleOrder.size(); ++position) {
+        mShufflePositions[mShuffleOrder[position]] = position;
+    }
+}
+
+int PlayListControler::drawShufflePosition(int position)
+{
+    const auto drawnPosition = mShuffleFrontier;
+
+    std::swap(mShuffleOrder[position], mShuffleOrder[drawnPosition]);
+    mShufflePositions[mShuffleOrder[position]] = position;
+    mShufflePositions[mShuffleOrder[drawnPosition]] = drawnPosition;
+
+    ++mShuffleFrontier;
+
+    return drawnPosition;
+}
+
+void PlayListControler::synchronizeShuffle()
+{
+    if (mShuffleOrder.size() != mPlayListModel->rowCount()) {
+        resetShuffle();
+        return;
+    }
+
+    const auto currentRow = mCurrentTrack.row();
+
+    if (mShuffleCursor >= 0 && mShuffleOrder[mShuffleCursor] == currentRow) {
+        return;
+    }
+
+    const auto currentPosition = mShufflePositions[currentRow];
+
+    if (currentPosition < mShuffleFrontier) {
+        mShuffleCursor = currentPosition;
+    } else {
+        mShuffleCursor = drawShufflePosition(currentPosition);
+    }
+}
+
+int PlayListControler::peekShuffledRow()
+{
+    if (mShuffleCursor + 1 < mShuffleFrontier) {
+        return mShuffleOrder[mShuffleCursor + 1];
+    }
+
+    if (mShuffleFrontier >= mShuffleOrder.size()) {
+        return -1;
+    }
+
+    return mShuffleOrder[drawShufflePosition(randomPosition(mShuffleFrontier, mShuffleOrder.size() - 1))];
+}
+
+int PlayListControler::nextShuffledRow()
+{
+    const auto nextRow = peekShuffledRow();
+
+    if (nextRow != -1) {
+        ++mShuffleCursor;
+    }
+
+    return nextRow;
+}
+
+int PlayListControler::previousShuffledRow()
+{
+    if (mShuffleCursor <= 0) {
+        return -1;
+    }
+
+    --mShuffleCursor;
+
+    return mShuffleOrder[mShuffleCursor];
+}
+
+void PlayListControler::insertShuffledRows(int first, int last)
+{
+    if (mShuffleOrder.isEmpty()) {
+        return;
+    }
+
+    const auto insertedCount = last - first + 1;
+
+    if (mShuffleOrder.size() + insertedCount != mPlayListModel->rowCount()) {
+        clearShuffle();
+        return;
+    }
+
+    for (auto &row : mShuffleOrder) {
+        if (row >= first) {
+            row += insertedCount;
+        }
+    }
+
+    mShuffleOrder.reserve(mShuffleOrder.size() + insertedCount);
+    for (int row = first; row <= last; ++row) {
+        mShuffleOrder.push_back(row);
+    }
+
+    updateShufflePositions();
+}
+
+void PlayListControler::removeShuffledRows(int first, int last)
+{
+    if (mShuffleOrder.isEmpty()) {
+        return;
+    }
+
+    const auto removedCount = last - first + 1;
+
+    if (mShuffleOrder.size() - removedCount != mPlayListModel->rowCount()) {
+        clearShuffle();
+        return;
+    }
+
+    auto newCursor = -1;
+    auto newFrontier = 0;
+    auto newPosition = 0;
+
+    for (int position = 0; position < mShuffleOrder.size(); ++position) {
+        const auto row = mShuffleOrder[position];
+
+        if (row >= first && row <= last) {
+            continue;
+        }
+
+        mShuffleOrder[newPosition] = (row > last ? row - removedCount : row);
+
+        if (position <= mShuffleCursor) {
+            newCursor = newPosition;
+        }
+
+        if (position < mShuffleFrontier) {
+            newFrontier = newPosition + 1;
+        }
+
+        ++newPosition;
+    }
+
+    mShuffleOrder.resize(newPosition);
+    mShuffleCursor = newCursor;
+    mShuffleFrontier = newFrontier;
+
+    updateShufflePositions();
+}
+
+void PlayListControler::moveShuffledRows(int start, int end, int destinationRow)
+{
+    if (mShuffleOrder.isEmpty()) {
+        return;
+    }
+
+    const auto movedCount = end - start + 1;
+
+    for (auto &row : mShuffleOrder) {
+        if (row >= start && row <= end) {
+            row += (destinationRow > end ? destinationRow - movedCount - start : destinationRow - start);
+        } else if (destinationRow > end && row > end && row < destinationRow) {
+            row -= movedCount;
+        } else if (destinationRow < start && row >= destinationRow && row < start) {
+            row += movedCount;
+        }
+    }
+
+    updateShufflePositions();
+}
 
 
 #include "moc_playlistcontroler.cpp"
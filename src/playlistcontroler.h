@@ -25,8 +25,11 @@
 #include <QPersistentModelIndex>
 #include <QAbstractItemModel>
 #include <QModelIndex>
+#include <QVector>
 #include <QUrl>
 
+#include <random>
+
 class QDataStream;
 
 class PlayListControler : public QObject
@@ -37,6 +40,10 @@ class PlayListControler : public QObject
                READ currentTrack
                NOTIFY currentTrackChanged)
 
+    Q_PROPERTY(QPersistentModelIndex nextTrack
+               READ nextTrack
+               NOTIFY nextTrackChanged)
+
     Q_PROPERTY(int currentTrackRow
                READ currentTrackRow
                NOTIFY currentTrackRowChanged)
@@ -82,6 +89,8 @@ public:
 
     QPersistentModelIndex currentTrack() const;
 
+    QPersistentModelIndex nextTrack() const;
+
     int currentTrackRow() const;
 
     QAbstractItemModel* playListModel() const;
@@ -104,6 +113,8 @@ Q_SIGNALS:
 
     void currentTrackChanged();
 
+    void nextTrackChanged();
+
     void currentTrackRowChanged();
 
     void playListModelChanged();
@@ -147,12 +158,16 @@ public Q_SLOTS:
 
     void tracksRemoved(const QModelIndex & parent, int first, int last);
 
+    void tracksMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row);
+
     void tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles = QVector<int> ());
 
     void skipNextTrack();
 
     void skipPreviousTrack();
 
+    void prepareNextTrack();
+
     void seedRandomGenerator(uint seed);
 
     void switchTo(int row);
@@ -169,8 +184,34 @@ private:
 
     void notifyCurrentTrackChanged();
 
+    int randomPosition(int first, int last);
+
+    void clearShuffle();
+
+    void resetShuffle();
+
+    void updateShufflePositions();
+
+    int drawShufflePosition(int position);
+
+    void synchronizeShuffle();
+
+    int peekShuffledRow();
+
+    int nextShuffledRow();
+
+    int previousShuffledRow();
+
+    void insertShuffledRows(int first, int last);
+
+    void removeShuffledRows(int first, int last);
+
+    void moveShuffledRows(int start, int end, int destinationRow);
+
     QPersistentModelIndex mCurrentTrack;
 
+    QPersistentModelIndex mNextTrack;
+
     int mCurrentPlayListPosition = 0;
 
     bool mCurrentTrackIsValid = false;
@@ -189,6 +230,16 @@ private:
 
     QVariantMap mPersistentState;
 
+    std::mt19937 mRandomGenerator;
+
+    QVector<int> mShuffleOrder;
+
+    QVector<int> mShufflePositions;
+
+    int mShuffleCursor = -1;
+
+    int mShuffleFrontier = 0;
+
 };
 
 #endif // PLAYLISTCONTROLER_H
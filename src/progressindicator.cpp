@@ -19,7 +19,7 @@
 
 #include "progressindicator.h"
 
-#include <QTime>
+#include <QChar>
 
 ProgressIndicator::ProgressIndicator(QObject *parent) : QObject(parent)
 {
@@ -45,15 +45,43 @@ void ProgressIndicator::setPosition(int position)
         return;
 
     mPosition = position;
+    Q_EMIT positionChanged();
+
+    const auto displayedSeconds = (mPosition > 0 ? mPosition / 1000 : 0);
+    if (mDisplayedSeconds == displayedSeconds)
+        return;
+
+    mDisplayedSeconds = displayedSeconds;
+
+    const auto hours = displayedSeconds / 3600;
+    const auto minutes = (displayedSeconds / 60) % 60;
+    const auto seconds = displayedSeconds % 60;
 
-    QTime currentProgress = QTime::fromMSecsSinceStartOfDay(mPosition);
-    if (currentProgress.hour() == 0) {
-        mProgressDuration = currentProgress.toString(QStringLiteral("m:ss"));
-    } else {
-        mProgressDuration = currentProgress.toString(QStringLiteral("h:mm:ss"));
+    QChar buffer[16];
+    int length = 0;
+
+    if (hours != 0) {
+        int digits = 1;
+        for (auto remainingHours = hours / 10; remainingHours != 0; remainingHours /= 10) {
+            ++digits;
+        }
+        for (int digit = digits - 1, remainingHours = hours; digit >= 0; --digit, remainingHours /= 10) {
+            buffer[length + digit] = QLatin1Char('0' + remainingHours % 10);
+        }
+        length += digits;
+        buffer[length++] = QLatin1Char(':');
+        buffer[length++] = QLatin1Char('0' + minutes / 10);
+    } else if (minutes >= 10) {
+        buffer[length++] = QLatin1Char('0' + minutes / 10);
     }
 
-    Q_EMIT positionChanged();
+    buffer[length++] = QLatin1Char('0' + minutes % 10);
+    buffer[length++] = QLatin1Char(':');
+    buffer[length++] = QLatin1Char('0' + seconds / 10);
+    buffer[length++] = QLatin1Char('0' + seconds % 10);
+
+    mProgressDuration.setUnicode(buffer, length);
+
     Q_EMIT progressDurationChanged();
 }
 
@@ -58,7 +58,9 @@ public Q_SLOTS:
 
 private:
 
-    int mPosition;
+    int mPosition = -1;
+
+    int mDisplayedSeconds = -1;
 
     QString mProgressDuration;
 
@@ -23,61 +23,115 @@
 
 #include <QSet>
 #include <QList>
-
-#include <array>
-#include <algorithm>
+#include <QHash>
+#include <QPair>
 
 class TracksListenerPrivate
 {
 public:
 
+    using TrackKey = QPair<QString, QPair<QString, QString>>;
+
+    static TrackKey trackKey(const QString &title, const QString &artist, const QString &album)
+    {
+        return {title, {artist, album}};
+    }
+
+    QList<qulonglong> knownTracksIds(const QList<qulonglong> &tracksIds) const;
+
+    QList<MusicAudioTrack> takeTracksByName(const QList<qulonglong> &addedTracks);
+
     QSet<qulonglong> mTracksByIdSet;
 
-    QList<std::array<QString, 3>> mTracksByNameSet;
+    QHash<TrackKey, int> mTracksByNameSet;
 
     DatabaseInterface *mDatabase = nullptr;
 
 };
 
-TracksListener::TracksListener(DatabaseInterface *database, QObject *parent) : QObject(parent), d(new TracksListenerPrivate)
+QList<qulonglong> TracksListenerPrivate::knownTracksIds(const QList<qulonglong> &tracksIds) const
 {
-    d->mDatabase = database;
+    auto result = QList<qulonglong>();
+
+    for (auto oneTrackId : tracksIds) {
+        if (mTracksByIdSet.contains(oneTrackId)) {
+            result.push_back(oneTrackId);
+        }
+    }
+
+    return result;
 }
 
-void TracksListener::trackAdded(qulonglong id)
+QList<MusicAudioTrack> TracksListenerPrivate::takeTracksByName(const QList<qulonglong> &addedTracks)
 {
-    if (d->mTracksByIdSet.find(id) != d->mTracksByIdSet.end()) {
-        const auto &newTrack = d->mDatabase->trackFromDatabaseId(id);
+    auto result = QList<MusicAudioTrack>();
 
-        Q_EMIT trackHasChanged(newTrack);
-    }
+    auto matchedTracksIds = QList<qulonglong>();
+    auto matchedTracksCount = QHash<qulonglong, int>();
 
-    if (d->mTracksByNameSet.isEmpty()) {
-        return;
-    }
+    const auto &allAddedTracksKey = mDatabase->tracksKeyFromDatabaseIds(addedTracks);
 
-    const auto &newTrack = d->mDatabase->trackFromDatabaseId(id);
+    for (const auto &oneTrack : allAddedTracksKey) {
+        auto itTrack = mTracksByNameSet.find(trackKey(oneTrack.title(), oneTrack.artist(), oneTrack.albumName()));
 
-    for (auto itTrack = d->mTracksByNameSet.begin(); itTrack != d->mTracksByNameSet.end(); ) {
-        if ((*itTrack)[0] != newTrack.title()) {
-            ++itTrack;
+        if (itTrack == mTracksByNameSet.end()) {
             continue;
         }
 
-        if ((*itTrack)[1] != newTrack.artist()) {
-            ++itTrack;
-            continue;
+        matchedTracksIds.push_back(oneTrack.databaseId());
+        matchedTracksCount[oneTrack.databaseId()] = itTrack.value();
+
+        mTracksByIdSet.insert(oneTrack.databaseId());
+        mTracksByNameSet.erase(itTrack);
+
+        if (mTracksByNameSet.isEmpty()) {
+            break;
         }
+    }
 
-        if ((*itTrack)[2] != newTrack.albumName()) {
-            ++itTrack;
-            continue;
+    if (matchedTracksIds.isEmpty()) {
+        return result;
+    }
+
+    const auto &matchedTracks = mDatabase->tracksFromDatabaseIds(matchedTracksIds);
+
+    for (const auto &oneTrack : matchedTracks) {
+        const auto trackCount = matchedTracksCount.value(oneTrack.databaseId());
+
+        for (int i = 0; i < trackCount; ++i) {
+            result.push_back(oneTrack);
         }
+    }
 
-        Q_EMIT trackHasChanged(newTrack);
+    return result;
+}
 
-        d->mTracksByIdSet.insert(newTrack.databaseId());
-        itTrack = d->mTracksByNameSet.erase(itTrack);
+TracksListener::TracksListener(DatabaseInterface *database, QObject *parent) : QObject(parent), d(new TracksListenerPrivate)
+{
+    d->mDatabase = database;
+}
+
+void TracksListener::trackAdded(qulonglong id)
+{
+    tracksAdded({id});
+}
+
+void TracksListener::tracksAdded(const QList<qulonglong> &allTracks)
+{
+    const auto &knownTracks = d->mDatabase->tracksFromDatabaseIds(d->knownTracksIds(allTracks));
+
+    for (const auto &oneTrack : knownTracks) {
+        Q_EMIT trackHasChanged(oneTrack);
+    }
+
+    if (d->mTracksByNameSet.isEmpty()) {
+        return;
+    }
+
+    const auto &resolvedTracks = d->takeTracksByName(allTracks);
+
+    for (const auto &oneTrack : resolvedTracks) {
+        Q_EMIT trackHasChanged(oneTrack);
     }
 }
 
@@ -90,6 +144,15 @@ void TracksListener::trackRemoved(qulonglong id)
     }
 }
 
+void TracksListener::tracksRemoved(const QList<MusicAudioTrack> &removedTracks)
+{
+    for (const auto &oneTrack : removedTracks) {
+        if (d->mTracksByIdSet.find(oneTrack.databaseId()) != d->mTracksByIdSet.end()) {
+            Q_EMIT trackHasBeenRemoved(oneTrack);
+        }
+    }
+}
+
 void TracksListener::trackModified(qulonglong id)
 {
     if (d->mTracksByIdSet.find(id) != d->mTracksByIdSet.end()) {
@@ -99,11 +162,20 @@ void TracksListener::trackModified(qulonglong id)
     }
 }
 
+void TracksListener::tracksModified(const QList<qulonglong> &modifiedTracks)
+{
+    const auto &knownTracks = d->mDatabase->tracksFromDatabaseIds(d->knownTracksIds(modifiedTracks));
+
+    for (const auto &oneTrack : knownTracks) {
+        Q_EMIT trackHasChanged(oneTrack);
+    }
+}
+
 void TracksListener::trackByNameInList(const QString &title, const QString &artist, const QString &album)
 {
     auto newTrackId = d->mDatabase->trackIdFromTitleAlbumArtist(title, album, artist);
     if (newTrackId == 0) {
-        d->mTracksByNameSet.push_back({{title, artist, album}});
+        ++d->mTracksByNameSet[TracksListenerPrivate::trackKey(title, artist, album)];
 
         return;
     }
@@ -127,6 +199,22 @@ void TracksListener::trackByIdInList(qulonglong newTrackId)
     }
 }
 
+void TracksListener::tracksByIdInList(const QList<qulonglong> &newTracksIds)
+{
+    for (auto oneTrackId : newTracksIds) {
+        d->mTracksByIdSet.insert(oneTrackId);
+    }
+
+    Q_EMIT tracksHaveBeenRestored(d->mDatabase->tracksFromDatabaseIds(newTracksIds));
+}
+
+void TracksListener::newTracksByIdInList(const QList<qulonglong> &newTracksIds)
+{
+    for (auto oneTrackId : newTracksIds) {
+        d->mTracksByIdSet.insert(oneTrackId);
+    }
+}
+
 void TracksListener::newArtistInList(const QString &artist)
 {
     auto newTracks = d->mDatabase->tracksFromAuthor(artist);
@@ -134,8 +222,23 @@ void TracksListener::newArtistInList(const QString &artist)
         return;
     }
 
+    for (const auto &oneTrack : newTracks) {
+        d->mTracksByIdSet.insert(oneTrack.databaseId());
+    }
+
     Q_EMIT albumAdded(newTracks);
 }
 
+void TracksListener::newAlbumInList(qulonglong albumId)
+{
+    auto newTracks = d->mDatabase->tracksFromAlbumId(albumId);
+
+    for (const auto &oneTrack : newTracks) {
+        d->mTracksByIdSet.insert(oneTrack.databaseId());
+    }
+
+    Q_EMIT albumTracksHaveBeenLoaded(albumId, newTracks);
+}
+
 
 #include "moc_trackslistener.cpp"
@@ -21,6 +21,7 @@
 #define TRACKSLISTENER_H
 
 #include <QObject>
+#include <QList>
 
 #include "musicaudiotrack.h"
 
@@ -43,20 +44,36 @@ Q_SIGNALS:
 
     void albumAdded(const QList<MusicAudioTrack> &tracks);
 
+    void tracksHaveBeenRestored(const QList<MusicAudioTrack> &audioTracks);
+
+    void albumTracksHaveBeenLoaded(qulonglong albumId, const QList<MusicAudioTrack> &tracks);
+
 public Q_SLOTS:
 
     void trackAdded(qulonglong id);
 
+    void tracksAdded(const QList<qulonglong> &allTracks);
+
     void trackRemoved(qulonglong id);
 
+    void tracksRemoved(const QList<MusicAudioTrack> &removedTracks);
+
     void trackModified(qulonglong id);
 
+    void tracksModified(const QList<qulonglong> &modifiedTracks);
+
     void trackByNameInList(const QString &title, const QString &artist, const QString &album);
 
     void trackByIdInList(qulonglong newTrackId);
 
+    void tracksByIdInList(const QList<qulonglong> &newTracksIds);
+
+    void newTracksByIdInList(const QList<qulonglong> &newTracksIds);
+
     void newArtistInList(const QString &artist);
 
+    void newAlbumInList(qulonglong albumId);
+
 private:
 
     TracksListenerPrivate *d = nullptr;
@@ -157,6 +157,10 @@ int __attribute__((visibility("default"))) main(int argc, char *argv[])
     qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
     qRegisterMetaType<MusicAlbum>("MusicAlbum");
     qRegisterMetaType<MusicArtist>("MusicArtist");
+    qRegisterMetaType<QList<MusicAlbum>>("QList<MusicAlbum>");
+    qRegisterMetaType<QList<MusicArtist>>("QList<MusicArtist>");
+    qRegisterMetaType<QList<qulonglong>>("QList<qulonglong>");
+    qRegisterMetaType<QHash<QUrl,QPair<qint64,QDateTime>>>("QHash<QUrl,QPair<qint64,QDateTime>>");
     qRegisterMetaType<QAction*>();
     qmlRegisterUncreatableType<ElisaApplication>("org.mgallien.QmlExtension", 1, 0, "ElisaApplication", QStringLiteral("only one and done in c++"));
 